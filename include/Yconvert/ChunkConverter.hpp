@@ -0,0 +1,137 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <ranges>
+#include <span>
+#include <vector>
+#include "Converter.hpp"
+#include "Generator.hpp"
+
+/** @file
+  * @brief Defines the ChunkConverter class and the convert_chunks function.
+  */
+
+namespace Yconvert
+{
+    /**
+     * @brief Converts input that arrives in chunks and yields the output in
+     *  chunks from an internal buffer.
+     *
+     * Each call to convert() returns a generator that converts one input
+     * chunk and yields spans of the converted text. The spans refer to
+     * ChunkConverter's internal buffer and are only valid until the
+     * generator is resumed, i.e. the consumer must write or copy each span
+     * before it asks for the next one. Characters that are split between
+     * two chunks are carried over to the next call. Call finish() after
+     * the last chunk.
+     *
+     * This makes it possible to interleave conversion with asynchronous
+     * I/O without callbacks and without holding the entire output
+     * in memory:
+     *
+     * @code
+     * ChunkConverter chunk_converter(converter);
+     * while (auto chunk = co_await read_some(socket))
+     *     for (auto output : chunk_converter.convert(chunk))
+     *         co_await write_all(file, output);
+     * for (auto output : chunk_converter.finish())
+     *     co_await write_all(file, output);
+     * @endcode
+     *
+     * The ChunkConverter, its Converter and the current input chunk must
+     * outlive the generator.
+     */
+    class YCONVERT_API ChunkConverter
+    {
+    public:
+        static constexpr size_t MIN_BUFFER_SIZE = 64;
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+        /**
+         * @brief Creates a ChunkConverter that uses @a converter and yields
+         *  output chunks of at most @a buffer_size bytes.
+         *
+         * @a buffer_size is raised to MIN_BUFFER_SIZE if it is smaller.
+         */
+        explicit ChunkConverter(Converter& converter,
+                                size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+        /**
+         * @brief Returns a generator that converts @a chunk.
+         */
+        [[nodiscard]]
+        Generator<std::span<const char>> convert(std::span<const char> chunk);
+
+        /**
+         * @brief Returns a generator that converts whatever remains of
+         *  the input.
+         *
+         * An incomplete character at the end of the input is handled
+         * according to the converter's error policy.
+         */
+        [[nodiscard]]
+        Generator<std::span<const char>> finish();
+
+        /**
+         * @brief Returns the number of bytes that have been carried over
+         *  from the previous chunk.
+         */
+        [[nodiscard]]
+        size_t pending_size() const;
+    private:
+        Generator<std::span<const char>>
+        convert_chunk(std::span<const char> chunk, bool is_final);
+
+        Converter& converter_;
+        std::vector<char> buffer_;
+        std::vector<char> carry_;
+    };
+
+    namespace Details
+    {
+        template <typename View>
+        Generator<std::span<const char>>
+        convert_chunks(View chunks, Converter& converter, size_t buffer_size)
+        {
+            ChunkConverter chunk_converter(converter, buffer_size);
+            for (auto&& chunk : chunks)
+            {
+                std::span<const char> bytes(
+                    reinterpret_cast<const char*>(std::ranges::data(chunk)),
+                    std::ranges::size(chunk) * sizeof(*std::ranges::data(chunk)));
+                for (auto output : chunk_converter.convert(bytes))
+                    co_yield output;
+            }
+
+            for (auto output : chunk_converter.finish())
+                co_yield output;
+        }
+    }
+
+    /**
+     * @brief Returns a generator that converts the chunks in @a chunks
+     *  with @a converter and yields the converted text in chunks of at most
+     *  @a buffer_size bytes.
+     *
+     * Each chunk must be a contiguous range, e.g. a std::string_view or a
+     * std::span<const char>. Lvalue ranges are referred to, not copied,
+     * and must outlive the generator, while rvalue ranges are moved into
+     * the generator. The yielded spans are only valid until the generator
+     * is resumed.
+     */
+    template <std::ranges::viewable_range R>
+        requires std::ranges::input_range<R>
+                 && std::ranges::contiguous_range<std::ranges::range_reference_t<R>>
+    Generator<std::span<const char>>
+    convert_chunks(R&& chunks, Converter& converter,
+                   size_t buffer_size = ChunkConverter::DEFAULT_BUFFER_SIZE)
+    {
+        return Details::convert_chunks(std::views::all(std::forward<R>(chunks)),
+                                       converter, buffer_size);
+    }
+}
@@ -0,0 +1,111 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <span>
+#include <string_view>
+#include "Encoding.hpp"
+
+/** @file
+  * @brief Defines the CodepointCursor class.
+  */
+
+namespace Yconvert
+{
+    /**
+     * @brief A position in a UTF-8, UTF-16 or UTF-32 buffer that can be
+     *  moved forward and backward one code point at a time.
+     *
+     * Moving backward relies on the encodings' self-synchronization:
+     * the cursor steps back over UTF-8 continuation bytes or a UTF-16
+     * low surrogate to find the start of the previous code point, so
+     * each step takes constant time regardless of the position in the
+     * buffer.
+     *
+     * The offset must always be at a code point boundary. Each byte of
+     * an invalid or incomplete UTF-8 sequence, and each unpaired UTF-16
+     * surrogate, is returned as a separate REPLACEMENT_CHARACTER in both
+     * directions.
+     *
+     * @code
+     * CodepointCursor cursor(text, Encoding::UTF_8, cursor_offset);
+     * char32_t c;
+     * while (cursor.prev(&c) && c != '\n')
+     * {}
+     * @endcode
+     */
+    class YCONVERT_API CodepointCursor
+    {
+    public:
+        CodepointCursor();
+
+        /**
+         * @brief Creates a cursor at byte @a offset in @a buffer.
+         *
+         * @a buffer must outlive the cursor.
+         *
+         * @throw YconvertException if @a encoding isn't one of the UTF
+         *  encodings.
+         */
+        CodepointCursor(const void* buffer, size_t size,
+                        Encoding encoding,
+                        size_t offset = 0);
+
+        template <typename CharType>
+        CodepointCursor(std::basic_string_view<CharType> str,
+                        Encoding encoding,
+                        size_t offset = 0)
+            : CodepointCursor(str.data(), str.size() * sizeof(CharType),
+                              encoding, offset)
+        {}
+
+        template <typename CharType>
+        CodepointCursor(std::span<CharType> str,
+                        Encoding encoding,
+                        size_t offset = 0)
+            : CodepointCursor(str.data(), str.size() * sizeof(CharType),
+                              encoding, offset)
+        {}
+
+        [[nodiscard]]
+        Encoding encoding() const;
+
+        /**
+         * @brief Returns the cursor's byte offset in the buffer.
+         */
+        [[nodiscard]]
+        size_t offset() const;
+
+        /**
+         * @brief Moves the cursor to byte @a offset in the buffer.
+         *
+         * @a offset is reduced to the size of the buffer if it is greater.
+         */
+        void set_offset(size_t offset);
+
+        /**
+         * @brief Reads the code point at the cursor and moves the cursor
+         *  past it.
+         *
+         * @return False if the cursor is at the end of the buffer.
+         */
+        bool next(char32_t* c);
+
+        /**
+         * @brief Moves the cursor to the start of the preceding code point
+         *  and reads it.
+         *
+         * @return False if the cursor is at the start of the buffer.
+         */
+        bool prev(char32_t* c);
+    private:
+        const char* buffer_ = nullptr;
+        size_t size_ = 0;
+        size_t offset_ = 0;
+        Encoding encoding_ = Encoding::UNKNOWN;
+    };
+}
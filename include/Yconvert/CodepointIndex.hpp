@@ -0,0 +1,147 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "CodepointIterator.hpp"
+
+/** @file
+  * @brief Defines the CodepointIndex class.
+  */
+
+namespace Yconvert
+{
+    /**
+     * @brief A sparse index of the code points in a buffer that makes it
+     *  possible to translate between code point indices and byte offsets
+     *  without decoding everything that precedes them.
+     *
+     * The index records the byte offset of every interval()th code point.
+     * A translation starts at the nearest preceding checkpoint and only
+     * has to count the code points after it. For UTF-8 and UTF-16 the
+     * index is built, and the code points after the checkpoint counted,
+     * 16 bytes or code units at a time. Other encodings are decoded.
+     *
+     * Code points are counted the way CodepointIterator counts them with
+     * the same error policy, e.g. with ErrorPolicy::REPLACE each invalid
+     * sequence counts as one code point.
+     *
+     * The buffer must outlive the index. The index can be serialized and
+     * later deserialized together with the same buffer.
+     *
+     * @code
+     * MappedFile file("huge.txt");
+     * CodepointIndex index(file.data(), file.size(), Encoding::UTF_8);
+     * auto it = index.seek(250'000'000);
+     * @endcode
+     */
+    class YCONVERT_API CodepointIndex
+    {
+    public:
+        static constexpr size_t DEFAULT_INTERVAL = 1024;
+
+        CodepointIndex();
+
+        /**
+         * @brief Builds an index of the code points in @a buffer.
+         *
+         * @a interval is raised to 1 if it is 0.
+         */
+        CodepointIndex(const void* buffer, size_t size,
+                       Encoding encoding,
+                       size_t interval = DEFAULT_INTERVAL,
+                       ErrorPolicy error_policy = ErrorPolicy::REPLACE);
+
+        template <typename CharType>
+        CodepointIndex(std::basic_string_view<CharType> str,
+                       Encoding encoding,
+                       size_t interval = DEFAULT_INTERVAL,
+                       ErrorPolicy error_policy = ErrorPolicy::REPLACE)
+            : CodepointIndex(str.data(), str.size() * sizeof(CharType),
+                             encoding, interval, error_policy)
+        {}
+
+        CodepointIndex(CodepointIndex&&) noexcept;
+
+        ~CodepointIndex();
+
+        CodepointIndex& operator=(CodepointIndex&&) noexcept;
+
+        [[nodiscard]]
+        Encoding encoding() const;
+
+        [[nodiscard]]
+        ErrorPolicy error_policy() const;
+
+        /**
+         * @brief Returns the number of code points between checkpoints.
+         */
+        [[nodiscard]]
+        size_t interval() const;
+
+        /**
+         * @brief Returns the number of code points in the buffer.
+         */
+        [[nodiscard]]
+        size_t size() const;
+
+        /**
+         * @brief Returns the byte offset of the code point at
+         *  @a codepoint_index.
+         *
+         * Returns the size of the buffer if @a codepoint_index is
+         * greater than or equal to size().
+         */
+        [[nodiscard]]
+        size_t byte_offset(size_t codepoint_index) const;
+
+        /**
+         * @brief Returns the index of the code point that contains the
+         *  byte at @a byte_offset.
+         *
+         * Returns size() if @a byte_offset is greater than or equal to
+         * the size of the buffer.
+         */
+        [[nodiscard]]
+        size_t codepoint_index(size_t byte_offset) const;
+
+        /**
+         * @brief Returns a CodepointIterator that starts at the code point
+         *  at @a codepoint_index.
+         */
+        [[nodiscard]]
+        CodepointIterator seek(size_t codepoint_index) const;
+
+        /**
+         * @brief Returns the index in a binary format that can be passed
+         *  to deserialize().
+         *
+         * The format is independent of the platform's byte order.
+         */
+        [[nodiscard]]
+        std::string serialize() const;
+
+        /**
+         * @brief Restores an index from @a data, which was created by
+         *  serialize(), for @a buffer.
+         *
+         * @throw YconvertException if @a data isn't a serialized index,
+         *  if it was created for a buffer of a different size, or if
+         *  its checkpoints are inconsistent.
+         */
+        [[nodiscard]]
+        static CodepointIndex deserialize(std::string_view data,
+                                          const void* buffer, size_t size);
+    private:
+        struct Data;
+        std::unique_ptr<Data> data_;
+    };
+}
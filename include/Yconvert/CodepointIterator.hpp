@@ -7,6 +7,8 @@
 //****************************************************************************
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <iosfwd>
 #include <memory>
 #include <span>
@@ -16,6 +18,9 @@
 
 namespace Yconvert
 {
+    class Decoder;
+    class MappedFile;
+
     /**
      * @brief An iterator that reads code points from a buffer or stream.
      *
@@ -33,13 +38,31 @@ namespace Yconvert
      * }
      * @endcode
      *
-     * @note This iterator does not support the range concept of std::ranges.
+     * @note This iterator does not support the range concept of std::ranges,
+     *  use codepoints() for that.
      */
     class YCONVERT_API CodepointIterator
     {
     public:
+        /**
+         * @brief The default maximum number of code points that are
+         *  decoded at a time.
+         */
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 256;
+
         CodepointIterator();
 
+        /**
+         * @brief Iterates over the code points in @a buffer.
+         *
+         * If @a encoding is Encoding::UTF_32_NATIVE and @a buffer is
+         * aligned for char32_t, the code points are read directly from
+         * @a buffer instead of being decoded into an internal buffer.
+         * Invalid values are still handled by the decoder according to
+         * @a error_policy, so the result is the same either way.
+         *
+         * @a buffer must outlive the iterator.
+         */
         CodepointIterator(const void* buffer, size_t size,
                           Encoding encoding,
                           ErrorPolicy error_policy = ErrorPolicy::REPLACE);
@@ -62,7 +85,23 @@ namespace Yconvert
                                 error_policy)
         {}
 
+        /**
+         * @brief Iterates over the code points in @a stream.
+         *
+         * @a stream_buffer_size is the number of bytes that are read
+         * from @a stream at a time.
+         */
         CodepointIterator(std::istream& stream,
+                          Encoding encoding,
+                          ErrorPolicy error_policy = ErrorPolicy::REPLACE,
+                          size_t stream_buffer_size = DEFAULT_STREAM_BUFFER_SIZE);
+
+        /**
+         * @brief Iterates over the code points in a memory-mapped file.
+         *
+         * @a file must outlive the iterator.
+         */
+        CodepointIterator(const MappedFile& file,
                           Encoding encoding,
                           ErrorPolicy error_policy = ErrorPolicy::REPLACE);
 
@@ -76,6 +115,18 @@ namespace Yconvert
 
         CodepointIterator& operator=(CodepointIterator&&) noexcept;
 
+        /**
+         * @brief Sets the maximum number of code points that are decoded
+         *  at a time.
+         *
+         * Larger buffers reduce the per-chunk overhead when iterating over
+         * long texts, see next_chunk(). Sizes other than
+         * DEFAULT_BUFFER_SIZE require a separate allocation. The new size
+         * takes effect the next time the buffer is filled, code points
+         * that have already been decoded are returned first.
+         */
+        void set_buffer_size(size_t size);
+
         /**
          * @brief Returns the next code point in the buffer or stream.
          * @param c Receives the next code point.
@@ -90,6 +141,39 @@ namespace Yconvert
             *c = chars_[i_++];
             return true;
         }
+
+        /**
+         * @brief Returns the code points that have been decoded, but not
+         *  yet read, and advances past them.
+         *
+         * If all decoded code points have been read, the next chunk is
+         * decoded first. The size of the chunks depends on the source
+         * and the encoding.
+         *
+         * @return A view of the code points. The view is only valid until
+         *    the next call to a member function that reads code points.
+         *    The view is empty when the end of the buffer or stream has
+         *    been reached.
+         */
+        std::u32string_view next_chunk()
+        {
+            if (i_ == chars_.size() && !fill_buffer())
+                return {};
+
+            auto chunk = chars_.substr(i_);
+            i_ = chars_.size();
+            return chunk;
+        }
+
+        /**
+         * @brief Reads code points into @a buffer until it is full or the
+         *  end of the buffer or stream has been reached.
+         *
+         * @return The number of code points written to @a buffer. It is
+         *    less than the size of @a buffer only if the end of the buffer
+         *    or stream has been reached.
+         */
+        size_t next_block(std::span<char32_t> buffer);
     private:
         bool fill_buffer();
 
@@ -100,6 +184,160 @@ namespace Yconvert
     };
 
 
+    namespace Details
+    {
+        /**
+         * @brief Holds a decoder in place, without heap allocations.
+         *
+         * This class is not intended to be used directly, it is used by
+         * BufferCodepointIterator.
+         */
+        class YCONVERT_API DecoderHolder
+        {
+        public:
+            /**
+             * @brief Large enough for any of the decoders.
+             */
+            static constexpr size_t STORAGE_SIZE = 1056;
+
+            DecoderHolder(Encoding encoding, ErrorPolicy error_policy);
+
+            DecoderHolder(const DecoderHolder&) = delete;
+
+            ~DecoderHolder();
+
+            DecoderHolder& operator=(const DecoderHolder&) = delete;
+
+            /**
+             * @brief Decodes code points from the start of @a input into
+             *  @a buffer and removes the bytes that have been read from
+             *  @a input.
+             *
+             * @return A view of the decoded code points. It refers to
+             *  @a input rather than @a buffer if @a input is aligned
+             *  native-endian UTF-32.
+             */
+            std::u32string_view read(std::span<const char>& input,
+                                     std::span<char32_t> buffer) const;
+        private:
+            alignas(std::max_align_t) unsigned char storage_[STORAGE_SIZE];
+            Decoder* decoder_;
+        };
+    }
+
+    /**
+     * @brief An iterator that reads code points from a buffer without
+     *  allocating memory.
+     *
+     * Unlike CodepointIterator, the decoder and the buffer of up to
+     * @a BUFFER_SIZE code points are stored inside the object itself,
+     * which makes this iterator cheap to create on the stack for short
+     * strings. It can't be moved or copied.
+     *
+     * @code
+     * BufferCodepointIterator<64> iter(name, Encoding::UTF_8);
+     * char32_t c;
+     * while (iter.next(&c))
+     * {
+     *     // Do something with c...
+     * }
+     * @endcode
+     */
+    template <size_t BUFFER_SIZE = CodepointIterator::DEFAULT_BUFFER_SIZE>
+    class BufferCodepointIterator
+    {
+    public:
+        static_assert(BUFFER_SIZE != 0);
+
+        BufferCodepointIterator(const void* buffer, size_t size,
+                                Encoding encoding,
+                                ErrorPolicy error_policy = ErrorPolicy::REPLACE)
+            : input_(static_cast<const char*>(buffer), size),
+              decoder_(encoding, error_policy)
+        {}
+
+        template <typename CharType>
+        BufferCodepointIterator(std::basic_string_view<CharType> str,
+                                Encoding encoding,
+                                ErrorPolicy error_policy = ErrorPolicy::REPLACE)
+            : BufferCodepointIterator(str.data(), str.size() * sizeof(CharType),
+                                      encoding, error_policy)
+        {}
+
+        template <typename CharType>
+        BufferCodepointIterator(std::span<CharType> str,
+                                Encoding encoding,
+                                ErrorPolicy error_policy = ErrorPolicy::REPLACE)
+            : BufferCodepointIterator(str.data(), str.size() * sizeof(CharType),
+                                      encoding, error_policy)
+        {}
+
+        /**
+         * @brief Returns the next code point in the buffer.
+         *
+         * @see CodepointIterator::next()
+         */
+        bool next(char32_t* c)
+        {
+            if (i_ == chars_.size() && !fill_buffer())
+                return false;
+
+            *c = chars_[i_++];
+            return true;
+        }
+
+        /**
+         * @brief Returns the code points that have been decoded, but not
+         *  yet read, and advances past them.
+         *
+         * @see CodepointIterator::next_chunk()
+         */
+        std::u32string_view next_chunk()
+        {
+            if (i_ == chars_.size() && !fill_buffer())
+                return {};
+
+            auto chunk = chars_.substr(i_);
+            i_ = chars_.size();
+            return chunk;
+        }
+
+        /**
+         * @brief Reads code points into @a buffer until it is full or the
+         *  end of the buffer has been reached.
+         *
+         * @see CodepointIterator::next_block()
+         */
+        size_t next_block(std::span<char32_t> buffer)
+        {
+            size_t n = 0;
+            while (n != buffer.size())
+            {
+                if (i_ == chars_.size() && !fill_buffer())
+                    break;
+
+                auto count = std::min(chars_.size() - i_, buffer.size() - n);
+                std::copy_n(chars_.data() + i_, count, buffer.data() + n);
+                i_ += count;
+                n += count;
+            }
+            return n;
+        }
+    private:
+        bool fill_buffer()
+        {
+            chars_ = decoder_.read(input_, buffer_);
+            i_ = 0;
+            return !chars_.empty();
+        }
+
+        std::span<const char> input_;
+        std::u32string_view chars_;
+        size_t i_ = 0;
+        Details::DecoderHolder decoder_;
+        char32_t buffer_[BUFFER_SIZE];
+    };
+
     /**
      * @brief Adapts a CodepointIterator to be used in range-based for loops.
      *
@@ -0,0 +1,190 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include "Encoding.hpp"
+#include "ErrorPolicy.hpp"
+
+/** @file
+  * @brief Defines the CodepointView class and the codepoints functions.
+  */
+
+namespace Yconvert
+{
+    class Decoder;
+
+    namespace Details
+    {
+        /**
+         * @brief Decodes the code point at @a pos and returns the number
+         *  of bytes it occupies, or 0 if there are no more code points.
+         */
+        YCONVERT_API size_t decode_codepoint(const Decoder& decoder,
+                                             const char* pos, const char* end,
+                                             char32_t& value);
+    }
+
+    /**
+     * @brief A view of the code points in a buffer.
+     *
+     * CodepointView models std::ranges::forward_range and can therefore
+     * be combined with std::views:
+     *
+     * @code
+     * for (char32_t c : codepoints(text, Encoding::UTF_8)
+     *                   | std::views::filter(is_letter))
+     * {
+     *     // Do something with c...
+     * }
+     * @endcode
+     *
+     * The iterators decode one code point at a time. count() and
+     * copy_to() decode the buffer in blocks instead, which is much faster
+     * than stepping through it. The number of code points isn't known
+     * without decoding the entire buffer, the view is therefore not a
+     * std::ranges::sized_range.
+     *
+     * The buffer must outlive the view and its iterators. Copies of a view
+     * share the decoder.
+     */
+    class YCONVERT_API CodepointView
+        : public std::ranges::view_interface<CodepointView>
+    {
+    public:
+        class Iterator
+        {
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = char32_t;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+
+            Iterator(const Decoder& decoder, std::span<const char> buffer)
+                : decoder_(&decoder),
+                  pos_(buffer.data()),
+                  end_(buffer.data() + buffer.size())
+            {
+                read();
+            }
+
+            char32_t operator*() const noexcept
+            {
+                return value_;
+            }
+
+            Iterator& operator++()
+            {
+                pos_ += size_;
+                read();
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                auto result = *this;
+                ++*this;
+                return result;
+            }
+
+            friend bool operator==(const Iterator& a, const Iterator& b) noexcept
+            {
+                return a.pos_ == b.pos_;
+            }
+
+            friend bool operator==(const Iterator& it, std::default_sentinel_t) noexcept
+            {
+                return it.size_ == 0;
+            }
+        private:
+            void read()
+            {
+                size_ = Details::decode_codepoint(*decoder_, pos_, end_, value_);
+            }
+
+            const Decoder* decoder_ = nullptr;
+            const char* pos_ = nullptr;
+            const char* end_ = nullptr;
+            char32_t value_ = INVALID_CHAR;
+            size_t size_ = 0;
+        };
+
+        CodepointView() = default;
+
+        CodepointView(const void* buffer, size_t size,
+                      Encoding encoding,
+                      ErrorPolicy error_policy = ErrorPolicy::REPLACE);
+
+        [[nodiscard]]
+        Iterator begin() const;
+
+        [[nodiscard]]
+        std::default_sentinel_t end() const noexcept
+        {
+            return {};
+        }
+
+        /**
+         * @brief Decodes the view and returns the number of code points
+         *  in it.
+         */
+        [[nodiscard]]
+        size_t count() const;
+
+        /**
+         * @brief Decodes code points from the start of the view into
+         *  @a buffer until either of them is exhausted.
+         *
+         * @return The number of code points written to @a buffer.
+         */
+        size_t copy_to(std::span<char32_t> buffer) const;
+    private:
+        std::span<const char> buffer_;
+        std::shared_ptr<const Decoder> decoder_;
+    };
+
+    /**
+     * @brief Returns a view of the code points in @a buffer.
+     */
+    [[nodiscard]]
+    inline CodepointView codepoints(const void* buffer, size_t size,
+                                    Encoding encoding,
+                                    ErrorPolicy error_policy = ErrorPolicy::REPLACE)
+    {
+        return {buffer, size, encoding, error_policy};
+    }
+
+    /**
+     * @brief Returns a view of the code points in @a str.
+     */
+    template <typename CharType>
+    [[nodiscard]]
+    CodepointView codepoints(std::basic_string_view<CharType> str,
+                             Encoding encoding,
+                             ErrorPolicy error_policy = ErrorPolicy::REPLACE)
+    {
+        return {str.data(), str.size() * sizeof(CharType), encoding, error_policy};
+    }
+
+    /**
+     * @brief Returns a view of the code points in @a str.
+     */
+    template <typename CharType>
+    [[nodiscard]]
+    CodepointView codepoints(std::span<CharType> str,
+                             Encoding encoding,
+                             ErrorPolicy error_policy = ErrorPolicy::REPLACE)
+    {
+        return {str.data(), str.size() * sizeof(CharType), encoding, error_policy};
+    }
+}
@@ -158,12 +158,20 @@ namespace Yconvert
         convert(source, destination, converter);
     }
 
+    /**
+     * @brief Converts the stream @a source with @a converter and writes
+     *  the result to @a destination.
+     *
+     * @a buffer_size is the number of bytes that are read from @a source
+     * at a time.
+     */
     template <typename CharT>
     void convert(std::istream& source,
                  std::basic_string<CharT>& destination,
-                 Converter& converter)
+                 Converter& converter,
+                 size_t buffer_size = DEFAULT_STREAM_BUFFER_SIZE)
     {
-        Details::InputStreamWrapper input(source);
+        Details::InputStreamWrapper input(source, buffer_size);
         while (input.fill())
         {
             auto result_offset = destination.size();
@@ -181,28 +189,187 @@ namespace Yconvert
     /**
      * @brief Converts the stream @a source with @a converter and writes
      * the result to @a destination.
+     *
+     * @a buffer_size is the number of bytes that are read from @a source
+     * at a time.
      */
     YCONVERT_API void convert(std::istream& source,
                               std::string& destination,
-                              Converter& converter);
+                              Converter& converter,
+                              size_t buffer_size = DEFAULT_STREAM_BUFFER_SIZE);
 
     /**
      * @brief Converts the stream @a source with @a converter and writes
      *  the result to @a destination.
+     *
+     * @a buffer_size is the number of bytes that are read from @a source
+     * at a time.
      */
     YCONVERT_API void convert(std::istream& source,
                               std::ostream& destination,
-                              Converter& converter);
+                              Converter& converter,
+                              size_t buffer_size = DEFAULT_STREAM_BUFFER_SIZE);
 
     /**
      * @brief Converts the stream @a source from @a source_encoding
      *  to @a destination_encoding and writes the result to @a destination.
+     *
+     * @a buffer_size is the number of bytes that are read from @a source
+     * at a time.
      */
     YCONVERT_API void convert(std::istream& source,
                               Encoding source_encoding,
                               std::ostream& destination,
                               Encoding destination_encoding,
-                              ErrorPolicy error_policy = ErrorPolicy::REPLACE);
+                              ErrorPolicy error_policy = ErrorPolicy::REPLACE,
+                              size_t buffer_size = DEFAULT_STREAM_BUFFER_SIZE);
+
+    /**
+     * @brief Converts the stream @a source with @a converter and writes
+     *  the result to @a destination, overlapping input and output.
+     *
+     * A separate thread reads and decodes @a source into a bounded ring of
+     * code point blocks while the calling thread encodes the blocks and
+     * writes them to @a destination. This lets I/O and conversion run in
+     * parallel on multi-core machines when converting large streams.
+     * Memory use is bounded, the reader is held back when the writer
+     * falls behind.
+     *
+     * Conversions that don't require decoding and encoding (see
+     * Converter::is_copy()), and conversions with an offset map, are
+     * done on the calling thread with convert(), so that the map is
+     * extended as usual.
+     *
+     * Exceptions thrown on the reader thread are rethrown on the calling
+     * thread.
+     *
+     * @a buffer_size is the number of bytes that are read from @a source
+     * at a time.
+     */
+    YCONVERT_API void convert_pipelined(std::istream& source,
+                                        std::ostream& destination,
+                                        Converter& converter,
+                                        size_t buffer_size = DEFAULT_STREAM_BUFFER_SIZE);
+
+    /**
+     * @brief Converts the stream @a source from @a source_encoding
+     *  to @a destination_encoding and writes the result to @a destination,
+     *  overlapping input and output.
+     *
+     * @see convert_pipelined(std::istream&, std::ostream&, Converter&)
+     */
+    YCONVERT_API void convert_pipelined(std::istream& source,
+                                        Encoding source_encoding,
+                                        std::ostream& destination,
+                                        Encoding destination_encoding,
+                                        ErrorPolicy error_policy = ErrorPolicy::REPLACE,
+                                        size_t buffer_size = DEFAULT_STREAM_BUFFER_SIZE);
+
+    /**
+     * @brief Detects the encoding of the string @a source, converts it
+     *  to @a destination_encoding and appends the result to
+     *  @a destination.
+     *
+     * The encoding is detected with an EncodingDetector, which only
+     * reads as much of @a source as it needs. A byte-order mark is not
+     * included in the result.
+     *
+     * @returns The detected encoding, or Encoding::UNKNOWN if @a source
+     *  is empty.
+     * @throw YconvertException if the encoding of a non-empty @a source
+     *  can't be detected.
+     */
+    YCONVERT_API Encoding
+    convert_auto(const void* source, size_t source_size,
+                 std::string& destination,
+                 Encoding destination_encoding,
+                 ErrorPolicy error_policy = ErrorPolicy::REPLACE);
+
+    /**
+     * @brief Detects the encoding of the string @a source, converts it
+     *  to @a destination_encoding and appends the result to
+     *  @a destination.
+     *
+     * @see convert_auto(const void*, size_t, std::string&, Encoding, ErrorPolicy)
+     */
+    template <typename CharT>
+    Encoding convert_auto(std::basic_string_view<CharT> source,
+                          std::string& destination,
+                          Encoding destination_encoding,
+                          ErrorPolicy error_policy = ErrorPolicy::REPLACE)
+    {
+        return convert_auto(source.data(), source.size() * sizeof(CharT),
+                            destination, destination_encoding, error_policy);
+    }
+
+    /**
+     * @brief Detects the encoding of the stream @a source, converts it
+     *  to @a destination_encoding and appends the result to
+     *  @a destination.
+     *
+     * The stream is read once, the bytes that are read to detect the
+     * encoding are buffered and converted with the rest of the stream,
+     * see DetectedStream. It doesn't need to support seekg.
+     *
+     * @returns The detected encoding, or Encoding::UNKNOWN if @a source
+     *  is empty.
+     * @throw YconvertException if the encoding of a non-empty @a source
+     *  can't be detected.
+     */
+    YCONVERT_API Encoding
+    convert_auto(std::istream& source,
+                 std::string& destination,
+                 Encoding destination_encoding,
+                 ErrorPolicy error_policy = ErrorPolicy::REPLACE);
+
+    /**
+     * @brief Detects the encoding of the stream @a source, converts it
+     *  to @a destination_encoding and writes the result to
+     *  @a destination.
+     *
+     * @see convert_auto(std::istream&, std::string&, Encoding, ErrorPolicy)
+     */
+    YCONVERT_API Encoding
+    convert_auto(std::istream& source,
+                 std::ostream& destination,
+                 Encoding destination_encoding,
+                 ErrorPolicy error_policy = ErrorPolicy::REPLACE);
+
+#ifndef _WIN32
+
+    /**
+     * @brief Reads the file descriptor @a source until end-of-file,
+     *  converts the contents with @a converter and writes the result to the
+     *  file descriptor @a destination.
+     *
+     * The data are transferred with POSIX read and write calls through
+     * large page-aligned buffers, bypassing iostreams entirely. If no
+     * conversion is necessary (the source and destination encodings are
+     * the same and the error policy is IGNORE), the bytes are moved with
+     * copy_file_range or sendfile where the platform supports it.
+     *
+     * @throw YconvertException if reading from @a source or writing
+     *  to @a destination fails.
+     */
+    YCONVERT_API void convert_fd(int source, int destination,
+                                 Converter& converter);
+
+    /**
+     * @brief Reads the file descriptor @a source until end-of-file,
+     *  converts the contents from @a source_encoding to
+     *  @a destination_encoding and writes the result to the file
+     *  descriptor @a destination.
+     *
+     * @throw YconvertException if reading from @a source or writing
+     *  to @a destination fails.
+     */
+    YCONVERT_API void convert_fd(int source,
+                                 Encoding source_encoding,
+                                 int destination,
+                                 Encoding destination_encoding,
+                                 ErrorPolicy error_policy = ErrorPolicy::REPLACE);
+
+#endif
 
     /**
      * @brief Converts the string @a source with @a converter
@@ -280,10 +447,11 @@ namespace Yconvert
      */
     template <typename StringT>
     StringT convert_to(std::istream& source,
-                       Converter& converter)
+                       Converter& converter,
+                       size_t buffer_size = DEFAULT_STREAM_BUFFER_SIZE)
     {
         StringT result;
-        convert(source, result, converter);
+        convert(source, result, converter, buffer_size);
         return result;
     }
 
@@ -295,10 +463,11 @@ namespace Yconvert
     StringT convert_to(std::istream& stream,
                        Encoding source_encoding,
                        Encoding result_encoding,
-                       ErrorPolicy error_policy = ErrorPolicy::REPLACE)
+                       ErrorPolicy error_policy = ErrorPolicy::REPLACE,
+                       size_t buffer_size = DEFAULT_STREAM_BUFFER_SIZE)
     {
         Converter converter(source_encoding, result_encoding);
         converter.set_error_policy(error_policy);
-        return convert_to<StringT>(stream, converter);
+        return convert_to<StringT>(stream, converter, buffer_size);
     }
 }
@@ -23,6 +23,8 @@ namespace Yconvert
 {
     class Decoder;
     class Encoder;
+    class MappedFile;
+    class OffsetMap;
 
     /** @brief Converts strings from one encoding to another.
       */
@@ -90,6 +92,25 @@ namespace Yconvert
           */
         void set_replacement_character(char32_t value);
 
+        /** @brief Returns the offset map that is extended by each
+          *     conversion, or nullptr.
+          */
+        [[nodiscard]]
+        OffsetMap* offset_map() const;
+
+        /** @brief Makes the converter record the mapping between source
+          *     and destination offsets in @a map while it converts.
+          *
+          * Each call to convert appends to @a map. The offsets of the
+          * conversion that stops early because the destination buffer is
+          * full are only recorded up to where it stopped. Recording
+          * requires decoding and encoding, which disables the faster
+          * copying and transcoding of some encoding pairs.
+          *
+          * The map must outlive the converter or be unset with nullptr.
+          */
+        void set_offset_map(OffsetMap* map);
+
         /** @brief Returns the source encoding.
           */
         [[nodiscard]]
@@ -100,6 +121,16 @@ namespace Yconvert
         [[nodiscard]]
         Encoding destination_encoding() const;
 
+        /** @brief Returns true if convert copies the source, possibly
+          *     swapping the byte order of each code unit, instead of
+          *     decoding and encoding it.
+          *
+          * Depends on the encodings, the error policy and whether an
+          * offset map has been set.
+          */
+        [[nodiscard]]
+        bool is_copy() const;
+
         [[nodiscard]]
         size_t get_encoded_size(const void* src, size_t src_size);
 
@@ -115,17 +146,63 @@ namespace Yconvert
                        std::ostream& dst,
                        bool src_is_final = true);
 
+        /** @brief Converts the entire contents of @a src and appends the
+          *     result to @a dst.
+          *
+          * The file is converted as a single buffer.
+          */
+        size_t convert(const MappedFile& src, std::string& dst);
+
+        /** @brief Updates @a dst and the offset map after the source has
+          *     been edited.
+          *
+          * @a src is the edited source. The @a old_size bytes starting at
+          * @a offset in the source that was converted to @a dst have been
+          * replaced with @a new_size bytes. The edit is widened to whole
+          * code points, plus one code point on either side that the new
+          * bytes may combine with, and only those are converted again and
+          * spliced into @a dst. The offset map is updated accordingly.
+          * The result is the same as converting all of @a src again, but
+          * the cost is proportional to the size of the edit, not the size
+          * of the source.
+          *
+          * @returns The offset and size of the converted edit in @a dst.
+          * @throw YconvertException if no offset map has been set, or if
+          *     the sizes of @a src and @a dst don't match the map.
+          */
+        std::pair<size_t, size_t> reconvert(const void* src, size_t src_size,
+                                            size_t offset,
+                                            size_t old_size,
+                                            size_t new_size,
+                                            std::string& dst);
+
+        /** @brief Converts the entire contents of @a src and writes the
+          *     result to @a dst.
+          *
+          * The file is converted as a single buffer.
+          */
+        size_t convert(const MappedFile& src, std::ostream& dst);
+
     private:
         enum class ConversionType
         {
             CONVERT,
             COPY,
-            SWAP_ENDIANNESS
+            SWAP_ENDIANNESS,
+            TRANSCODE
         };
 
+        using Transcoder = std::pair<size_t, size_t> (*)(
+            const void* src, size_t src_size, void* dst, size_t dst_size);
+
         static ConversionType get_conversion_type(Encoding src,
                                                   Encoding dst);
 
+        static Transcoder get_transcoder(Encoding src, Encoding dst);
+
+        [[nodiscard]]
+        ConversionType effective_conversion_type() const;
+
         size_t do_convert(const void* src, size_t src_size,
                           std::string& dst,
                           bool src_is_final);
@@ -138,6 +215,11 @@ namespace Yconvert
                           std::ostream& dst,
                           bool src_is_final);
 
+        void record_offsets(const char* src, size_t src_size,
+                            const char32_t* code_points, size_t count,
+                            size_t dst_size,
+                            bool src_is_final);
+
         size_t copy(const void* src, size_t src_size,
                     void* dst, size_t dst_size);
 
@@ -147,9 +229,23 @@ namespace Yconvert
         size_t copy_and_swap(const void* src, size_t src_size,
                              std::ostream& stream);
 
+        std::pair<size_t, size_t> transcode(const void* src, size_t src_size,
+                                            void* dst, size_t dst_size,
+                                            bool src_is_final);
+
+        size_t transcode(const void* src, size_t src_size,
+                         std::string& dst,
+                         bool src_is_final);
+
+        size_t transcode(const void* src, size_t src_size,
+                         std::ostream& dst,
+                         bool src_is_final);
+
         std::unique_ptr<Decoder> decoder_;
         std::unique_ptr<Encoder> encoder_;
         ConversionType conversion_type_;
+        Transcoder transcoder_;
         std::vector<char32_t> buffer_;
+        OffsetMap* offset_map_ = nullptr;
     };
 }
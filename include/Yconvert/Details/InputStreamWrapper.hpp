@@ -6,6 +6,7 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
+#include <cstddef>
 #include <iosfwd>
 #include <vector>
 #include "Yconvert/YconvertDefinitions.hpp"
@@ -14,12 +15,30 @@ namespace Yconvert::Details
 {
     /**
      * @brief A wrapper for std::istream that allows reading from the stream
-     *     in small chunks.
+     *     in chunks.
+     *
+     * The buffer consists of a small carry area followed by the area the
+     * stream is read into. Whatever the consumer leaves undrained at the
+     * end of a chunk (normally an incomplete character) is copied to the
+     * end of the carry area so it directly precedes the next chunk, the
+     * rest of the buffer is never moved. The stream is read through its
+     * streambuf to avoid the overhead of std::istream::read.
      */
     class YCONVERT_API InputStreamWrapper
     {
     public:
-        explicit InputStreamWrapper(std::istream& stream);
+        static constexpr size_t MIN_CAPACITY = 256;
+        static constexpr size_t MAX_CAPACITY = 4 * 1024 * 1024;
+        static constexpr size_t DEFAULT_CAPACITY = DEFAULT_STREAM_BUFFER_SIZE;
+
+        /**
+         * @brief Creates a wrapper that reads @a stream in chunks of
+         *  @a capacity bytes.
+         *
+         * @a capacity is clamped to the range [MIN_CAPACITY, MAX_CAPACITY].
+         */
+        explicit InputStreamWrapper(std::istream& stream,
+                                    size_t capacity = DEFAULT_CAPACITY);
 
         /**
          * @brief Fills the buffer with data from the stream.
@@ -46,15 +65,24 @@ namespace Yconvert::Details
         [[nodiscard]]
         size_t size() const;
 
+        /**
+         * @brief Returns the maximum number of bytes read from the stream
+         *  in one go.
+         */
+        [[nodiscard]]
+        size_t capacity() const;
+
         /**
          * @brief Returns true if the stream is at the end.
          */
         [[nodiscard]]
         bool eof() const;
     private:
+        size_t read(char* buffer, size_t size);
+
         std::istream* stream_;
-        char buffer_[Yconvert::BUFFER_SIZE];
+        std::vector<char> buffer_;
         size_t size_ = 0;
-        size_t offset_ = 0;
+        size_t offset_;
     };
 }
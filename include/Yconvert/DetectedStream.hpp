@@ -0,0 +1,85 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <istream>
+#include <memory>
+#include "EncodingDetection.hpp"
+
+/** @file
+  * @brief Defines the DetectedStream class.
+  */
+
+namespace Yconvert
+{
+    namespace Detail
+    {
+        class ReplayStreamBuf;
+    }
+
+    /**
+     * @brief An input stream that detects the encoding of another stream
+     *  without seeking in it.
+     *
+     * The constructor reads a prefix of the underlying stream into a
+     * buffer and feeds it to an EncodingDetector until the encoding has
+     * been decided. Reading from the DetectedStream then returns the
+     * prefix, without the byte-order mark, followed by the rest of the
+     * underlying stream. It can therefore be used with streams that
+     * don't support seekg, e.g. std::cin, pipes and sockets, and be
+     * passed directly to convert() and CodepointIterator:
+     *
+     * @code
+     * Yconvert::DetectedStream stream(std::cin);
+     * Yconvert::Converter converter(stream.encoding(), Yconvert::Encoding::UTF_8);
+     * Yconvert::convert(stream, std::cout, converter);
+     * @endcode
+     *
+     * Bytes that follow the prefix are read from the underlying stream's
+     * streambuf directly into the caller's buffer.
+     *
+     * The underlying stream must outlive the DetectedStream.
+     */
+    class YCONVERT_API DetectedStream : public std::istream
+    {
+    public:
+        explicit DetectedStream(
+            std::istream& stream,
+            size_t max_size = DEFAULT_DETECTION_SIZE,
+            double threshold = DEFAULT_DETECTION_THRESHOLD);
+
+        DetectedStream(const DetectedStream&) = delete;
+
+        ~DetectedStream() override;
+
+        DetectedStream& operator=(const DetectedStream&) = delete;
+
+        /**
+         * @brief Returns the detected encoding, or Encoding::UNKNOWN if
+         *  the underlying stream is empty.
+         */
+        [[nodiscard]]
+        Encoding encoding() const;
+
+        /**
+         * @brief Returns the encodings the stream may be in, ordered from
+         *  most to least likely.
+         */
+        [[nodiscard]]
+        const std::vector<EncodingCandidate>& candidates() const;
+
+        /**
+         * @brief Returns the size of the byte-order mark that was
+         *  removed from the start of the stream.
+         */
+        [[nodiscard]]
+        size_t byte_order_mark_size() const;
+    private:
+        EncodingDetector detector_;
+        std::unique_ptr<Detail::ReplayStreamBuf> buffer_;
+    };
+}
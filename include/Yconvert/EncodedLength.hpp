@@ -0,0 +1,61 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <span>
+#include "Endian.hpp"
+#include "YconvertDefinitions.hpp"
+
+/** @file
+  * @brief Defines functions that compute the length of a string converted
+  *     between UTF-8 and UTF-16 without converting it.
+  */
+
+namespace Yconvert
+{
+    /**
+     * @brief The result of the functions that compute the length of
+     *  a converted string.
+     */
+    struct EncodedLength
+    {
+        /// The length of the converted string in code units.
+        size_t length = 0;
+        /// False if the input contains invalid or incomplete code points.
+        bool valid = false;
+    };
+
+    /**
+     * @brief Returns the number of UTF-16 code units required to
+     *  represent the UTF-8 string @a utf8.
+     *
+     * The input is counted, not converted, mostly 16 bytes at a time.
+     * The input is valid only if it is well-formed UTF-8: overlong
+     * sequences, surrogates (U+D800 to U+DFFF) and code points above
+     * U+10FFFF are invalid, even though Converter's UTF-8 decoder accepts
+     * the first two. If the input is invalid, the length is that of the
+     * part preceding the first invalid code point.
+     */
+    [[nodiscard]]
+    YCONVERT_API EncodedLength utf16_length_from_utf8(std::span<const char> utf8);
+
+    /**
+     * @brief Returns the number of bytes required to represent the UTF-16
+     *  string @a utf16 as UTF-8.
+     *
+     * @a endianness is the byte order of the code units in @a utf16,
+     * Endianness::UNKNOWN is treated as the native byte order.
+     *
+     * The input is counted, not converted, 16 code units at a time.
+     * If the input is invalid, the length is that of the part preceding
+     * the first invalid code point.
+     */
+    [[nodiscard]]
+    YCONVERT_API EncodedLength utf8_length_from_utf16(
+        std::span<const char16_t> utf16,
+        Endianness endianness = Endianness::NATIVE);
+}
@@ -8,6 +8,7 @@
 #pragma once
 #include <iosfwd>
 #include <string>
+#include <string_view>
 #include "Endian.hpp"
 #include "YconvertDefinitions.hpp"
 
@@ -108,9 +109,17 @@ namespace Yconvert
     YCONVERT_API std::pair<const EncodingInfo*, size_t> get_all_encodings();
 
     /**
-     * @brief Returns the @a Encoding that corresponds to @a name.
+     * @brief Returns the @a Encoding that corresponds to @a name, or
+     *  Encoding::UNKNOWN if there is none.
+     *
+     * @a name is compared case-insensitively with the names in
+     * EncodingInfo and the aliases in the IANA character set registry,
+     * e.g. "windows-1252", "cp1252" and "ISO_8859-1:1987". The lookup
+     * uses a perfect hash table that is built at compile time, and
+     * doesn't allocate memory.
      */
-    YCONVERT_API Encoding encoding_from_name(std::string name);
+    [[nodiscard]]
+    YCONVERT_API Encoding encoding_from_name(std::string_view name);
 
     /**
      * @brief Checks the list of known byte-order marks and returns the one
@@ -154,6 +163,7 @@ namespace Yconvert
      * @throw YconvertException if it was not possible to to set the position
      *  indicator of @a stream with std::ios::seekg. std::cin, for instance,
      *  does not necessarily support seekg.
+     * @see DetectedStream for streams that don't support seekg.
      */
     YCONVERT_API Encoding determine_encoding(std::istream& stream);
 
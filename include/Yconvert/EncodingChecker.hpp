@@ -12,6 +12,7 @@
 namespace Yconvert
 {
     class Decoder;
+    class MappedFile;
 
     class YCONVERT_API EncodingChecker
     {
@@ -37,8 +38,15 @@ namespace Yconvert
         std::pair<size_t, size_t>
         count_valid_codepoints(const void* buffer, size_t length) const;
 
+        [[nodiscard]]
+        std::pair<size_t, size_t>
+        count_valid_codepoints(const MappedFile& file) const;
+
         [[nodiscard]]
         bool check_encoding(const void* buffer, size_t length) const;
+
+        [[nodiscard]]
+        bool check_encoding(const MappedFile& file) const;
     private:
         std::unique_ptr<Decoder> decoder_;
     };
@@ -0,0 +1,185 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "Encoding.hpp"
+
+/** @file
+  * @brief Defines functions and classes that detect the encoding of a
+  *     text by analyzing its contents.
+  */
+
+namespace Yconvert
+{
+    namespace Detail
+    {
+        class EncodingStatistics;
+    }
+
+    /**
+     * @brief An encoding and how confident the detector is that a text
+     *  uses it.
+     */
+    struct EncodingCandidate
+    {
+        Encoding encoding = Encoding::UNKNOWN;
+        /// A value between 0 and 1, where 1 means that the encoding was
+        /// determined from a byte-order mark.
+        double confidence = 0;
+    };
+
+    /**
+     * @brief The number of bytes detect_encodings scans by default.
+     */
+    constexpr size_t DEFAULT_DETECTION_SIZE = 64 * 1024;
+
+    /**
+     * @brief Analyzes the first @a max_size bytes of @a buffer and
+     *  returns the encodings it may be in, ordered from most to least
+     *  likely.
+     *
+     * A byte-order mark decides the encoding. Otherwise the buffer is
+     * scanned once, 16 bytes at a time, while byte histograms for even
+     * and odd offsets, the number of zero bytes at each position modulo
+     * 4, and whether the bytes are valid UTF-8, UTF-16 and UTF-32 in
+     * either byte order are gathered. The confidences are computed from
+     * these statistics.
+     *
+     * Pass SIZE_MAX as @a max_size to scan the entire buffer. If the
+     * scan stops before the end of the buffer, an incomplete character
+     * at the end of the scanned bytes isn't counted as an error.
+     *
+     * Encodings with a confidence of 0 are not included in the result,
+     * which is empty if @a buffer is.
+     */
+    [[nodiscard]]
+    YCONVERT_API std::vector<EncodingCandidate>
+    detect_encodings(const void* buffer, size_t size,
+                     size_t max_size = DEFAULT_DETECTION_SIZE);
+
+    /**
+     * @brief The confidence at which EncodingDetector by default decides
+     *  the encoding.
+     */
+    constexpr double DEFAULT_DETECTION_THRESHOLD = 0.95;
+
+    /**
+     * @brief Detects the encoding of a text that arrives in chunks, e.g.
+     *  from a socket or a pipe.
+     *
+     * The detector gathers the same statistics as detect_encodings, and
+     * decides the encoding as soon as the evidence is strong enough:
+     *
+     * - A byte-order mark decides the encoding as soon as the first four
+     *   bytes have arrived.
+     * - Otherwise the encoding is decided when the confidence of the
+     *   most likely encoding reaches the threshold, but not before
+     *   MIN_DECISION_SIZE bytes have arrived. A byte sequence that is
+     *   invalid in UTF-8 rules out UTF-8, but doesn't decide the
+     *   encoding by itself.
+     * - Text that remains ambiguous, e.g. plain ASCII, is read until
+     *   @a max_size bytes have arrived.
+     *
+     * Bytes that are added after the encoding has been decided are
+     * ignored.
+     */
+    class YCONVERT_API EncodingDetector
+    {
+    public:
+        /**
+         * @brief The number of bytes that must have arrived before the
+         *  confidence threshold can decide the encoding.
+         */
+        static constexpr size_t MIN_DECISION_SIZE = 256;
+
+        explicit EncodingDetector(
+            size_t max_size = DEFAULT_DETECTION_SIZE,
+            double threshold = DEFAULT_DETECTION_THRESHOLD);
+
+        EncodingDetector(EncodingDetector&&) noexcept;
+
+        EncodingDetector(const EncodingDetector&) = delete;
+
+        ~EncodingDetector();
+
+        EncodingDetector& operator=(EncodingDetector&&) noexcept;
+
+        EncodingDetector& operator=(const EncodingDetector&) = delete;
+
+        /**
+         * @brief Adds the next @a size bytes of the text.
+         *
+         * @return true if the encoding has been decided.
+         */
+        bool add(const void* data, size_t size);
+
+        /**
+         * @brief Informs the detector that there is no more text and
+         *  decides the encoding.
+         */
+        void finish();
+
+        /**
+         * @brief Returns true if the encoding has been decided.
+         */
+        [[nodiscard]]
+        bool is_done() const;
+
+        /**
+         * @brief Returns the most likely encoding, or Encoding::UNKNOWN
+         *  if no bytes have been analyzed yet.
+         *
+         * The encoding can change until is_done returns true.
+         */
+        [[nodiscard]]
+        Encoding encoding() const;
+
+        /**
+         * @brief Returns the encodings the text may be in, ordered from
+         *  most to least likely.
+         *
+         * If the text starts with a byte-order mark, the result only
+         * contains the corresponding encoding.
+         */
+        [[nodiscard]]
+        const std::vector<EncodingCandidate>& candidates() const;
+
+        /**
+         * @brief Returns the size of the byte-order mark at the start of
+         *  the text, or 0 if there isn't one.
+         */
+        [[nodiscard]]
+        size_t byte_order_mark_size() const;
+
+        /**
+         * @brief Returns the number of bytes that have been analyzed,
+         *  including the byte-order mark.
+         */
+        [[nodiscard]]
+        size_t size() const;
+    private:
+        void check_byte_order_mark();
+
+        void update(bool final);
+
+        void rank() const;
+
+        std::unique_ptr<Detail::EncodingStatistics> stats_;
+        mutable std::vector<EncodingCandidate> candidates_;
+        mutable bool is_ranked_ = true;
+        char head_[4] = {};
+        size_t size_ = 0;
+        size_t max_size_;
+        double threshold_;
+        size_t bom_size_ = 0;
+        bool bom_checked_ = false;
+        bool done_ = false;
+    };
+}
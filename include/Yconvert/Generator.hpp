@@ -0,0 +1,176 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+/** @file
+  * @brief Defines the Generator class template.
+  */
+
+namespace Yconvert
+{
+    /**
+     * @brief A minimal coroutine generator that yields values of type @a T.
+     *
+     * The generator is an input range. The coroutine is started by begin()
+     * and runs until the next co_yield each time the iterator is
+     * incremented. References to the values returned by the iterator are
+     * only valid until the iterator is incremented.
+     *
+     * Exceptions thrown by the coroutine are rethrown by begin() or by the
+     * increment operator.
+     */
+    template <typename T>
+    class Generator
+    {
+    public:
+        struct promise_type
+        {
+            const T* value = nullptr;
+            std::exception_ptr exception;
+
+            Generator get_return_object() noexcept
+            {
+                return Generator(handle::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always yield_value(const T& v) noexcept
+            {
+                value = std::addressof(v);
+                return {};
+            }
+
+            void return_void() const noexcept
+            {}
+
+            void unhandled_exception() noexcept
+            {
+                exception = std::current_exception();
+            }
+
+            // co_await is not supported inside a generator.
+            template <typename U>
+            void await_transform(U&&) = delete;
+        };
+
+        using handle = std::coroutine_handle<promise_type>;
+
+        struct Sentinel
+        {};
+
+        class Iterator
+        {
+        public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+
+            explicit Iterator(handle coroutine) noexcept
+                : coroutine_(coroutine)
+            {}
+
+            const T& operator*() const noexcept
+            {
+                return *coroutine_.promise().value;
+            }
+
+            const T* operator->() const noexcept
+            {
+                return coroutine_.promise().value;
+            }
+
+            Iterator& operator++()
+            {
+                resume(coroutine_);
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                ++*this;
+            }
+
+            friend bool operator==(const Iterator& it, Sentinel) noexcept
+            {
+                return !it.coroutine_ || it.coroutine_.done();
+            }
+        private:
+            handle coroutine_ = {};
+        };
+
+        Generator() = default;
+
+        Generator(Generator&& other) noexcept
+            : coroutine_(std::exchange(other.coroutine_, {}))
+        {}
+
+        ~Generator()
+        {
+            if (coroutine_)
+                coroutine_.destroy();
+        }
+
+        Generator& operator=(Generator&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (coroutine_)
+                    coroutine_.destroy();
+                coroutine_ = std::exchange(other.coroutine_, {});
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Starts the coroutine and returns an iterator to the first
+         *  yielded value.
+         *
+         * Must only be called once.
+         */
+        Iterator begin()
+        {
+            if (coroutine_)
+                resume(coroutine_);
+            return Iterator(coroutine_);
+        }
+
+        Sentinel end() const noexcept
+        {
+            return {};
+        }
+    private:
+        explicit Generator(handle coroutine) noexcept
+            : coroutine_(coroutine)
+        {}
+
+        static void resume(handle coroutine)
+        {
+            coroutine.resume();
+            if (coroutine.done() && coroutine.promise().exception)
+                std::rethrow_exception(coroutine.promise().exception);
+        }
+
+        handle coroutine_ = {};
+    };
+}
@@ -0,0 +1,81 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <span>
+#include <string>
+#include "YconvertDefinitions.hpp"
+
+/** @file
+  * @brief Defines the MappedFile class.
+  */
+
+namespace Yconvert
+{
+    /**
+     * @brief A read-only, memory-mapped file.
+     *
+     * The entire file is made available as a single contiguous buffer
+     * without being copied, which lets Converter, EncodingChecker and
+     * CodepointIterator process it in one pass without the chunking
+     * that stream input requires. The mapping is advised for sequential
+     * access.
+     *
+     * Objects that are given a MappedFile refer to its memory directly,
+     * the MappedFile must therefore outlive them.
+     */
+    class YCONVERT_API MappedFile
+    {
+    public:
+        MappedFile();
+
+        /**
+         * @brief Maps the file at @a path into memory.
+         * @throw YconvertException if the file can not be opened
+         *  or mapped.
+         */
+        explicit MappedFile(const std::string& path);
+
+        MappedFile(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+
+        ~MappedFile();
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /**
+         * @brief Returns a pointer to the first byte in the file.
+         *
+         * The pointer is null if the file is empty or no file is mapped.
+         */
+        [[nodiscard]]
+        const char* data() const;
+
+        /**
+         * @brief Returns the size of the file in bytes.
+         */
+        [[nodiscard]]
+        size_t size() const;
+
+        /**
+         * @brief Returns the contents of the file.
+         */
+        [[nodiscard]]
+        std::span<const char> span() const;
+
+        /**
+         * @brief Unmaps the file.
+         */
+        void close();
+    private:
+        const char* data_ = nullptr;
+        size_t size_ = 0;
+    };
+}
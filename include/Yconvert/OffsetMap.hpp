@@ -0,0 +1,164 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "YconvertDefinitions.hpp"
+
+/** @file
+  * @brief Defines the OffsetMap class.
+  */
+
+namespace Yconvert
+{
+    /**
+     * @brief A sequence of consecutive code points that have the same
+     *  length in the source and the destination.
+     */
+    struct OffsetRun
+    {
+        /// The byte offset of the first code point in the source.
+        size_t source_offset = 0;
+        /// The byte offset of the first code point in the destination.
+        size_t destination_offset = 0;
+        /// The number of code points in the run.
+        size_t count = 0;
+        /// The length in bytes of each code point in the source.
+        uint32_t source_width = 0;
+        /// The length in bytes of each code point in the destination.
+        /// It is 0 for source bytes that were skipped.
+        uint32_t destination_width = 0;
+    };
+
+    /**
+     * @brief A run-length encoded mapping between byte offsets in
+     *  the source and the destination of a conversion.
+     *
+     * An OffsetMap is filled by a Converter that it has been given with
+     * Converter::set_offset_map. Consecutive code points whose lengths
+     * are the same in both encodings are stored as a single run, e.g.
+     * ASCII text converted from UTF-8 to UTF-16 is one run until the
+     * first non-ASCII character. Offsets are translated with a binary
+     * search among the runs, neither the source nor the destination is
+     * needed.
+     *
+     * The offsets are counted from the start of the first conversion
+     * after the map was cleared, successive calls to Converter::convert
+     * extend the map.
+     *
+     * @code
+     * OffsetMap map;
+     * Converter converter(Encoding::UTF_8, Encoding::UTF_16_LE);
+     * converter.set_offset_map(&map);
+     * std::string utf16;
+     * converter.convert(utf8.data(), utf8.size(), utf16);
+     * auto utf8_offset = map.to_source(hit_offset * 2);
+     * @endcode
+     */
+    class YCONVERT_API OffsetMap
+    {
+    public:
+        /**
+         * @brief Appends @a count code points that are @a source_width
+         *  bytes long in the source and @a destination_width bytes long
+         *  in the destination.
+         */
+        void add(size_t count, uint32_t source_width,
+                 uint32_t destination_width);
+
+        /**
+         * @brief Removes all runs and resets the sizes to 0.
+         */
+        void clear();
+
+        [[nodiscard]]
+        bool empty() const;
+
+        /**
+         * @brief Returns the number of source bytes in the map.
+         */
+        [[nodiscard]]
+        size_t source_size() const;
+
+        /**
+         * @brief Returns the number of destination bytes in the map.
+         */
+        [[nodiscard]]
+        size_t destination_size() const;
+
+        [[nodiscard]]
+        const std::vector<OffsetRun>& runs() const;
+
+        /**
+         * @brief Returns the start of the code point that contains
+         *  @a source_offset.
+         *
+         * Offsets at or beyond source_size() are mapped to source_size().
+         */
+        [[nodiscard]]
+        size_t floor_source_offset(size_t source_offset) const;
+
+        /**
+         * @brief Returns the end of the code point that contains
+         *  @a source_offset, or @a source_offset itself if it is at the
+         *  start of a code point.
+         *
+         * Offsets at or beyond source_size() are mapped to source_size().
+         */
+        [[nodiscard]]
+        size_t ceil_source_offset(size_t source_offset) const;
+
+        /**
+         * @brief Replaces the code points in the @a source_size bytes
+         *  starting at @a source_offset with the contents of @a map.
+         *
+         * @a source_offset and @a source_offset + @a source_size must be
+         * at the start of code points, or at the end of the source. The
+         * offsets of the runs that follow are adjusted, runs are merged
+         * where the replacement meets the surrounding runs.
+         *
+         * @throw YconvertException if the range isn't within the map.
+         */
+        void replace(size_t source_offset, size_t source_size,
+                     const OffsetMap& map);
+
+        /**
+         * @brief Returns the destination offset that corresponds to
+         *  @a source_offset.
+         *
+         * Offsets inside a code point are mapped to the start of the
+         * code point. Offsets at or beyond source_size() are mapped to
+         * destination_size().
+         */
+        [[nodiscard]]
+        size_t to_destination(size_t source_offset) const;
+
+        /**
+         * @brief Returns the source offset that corresponds to
+         *  @a destination_offset.
+         *
+         * Offsets inside a code point are mapped to the start of the
+         * code point. Offsets at or beyond destination_size() are mapped
+         * to source_size().
+         */
+        [[nodiscard]]
+        size_t to_source(size_t destination_offset) const;
+    private:
+        [[nodiscard]]
+        size_t find_run(size_t source_offset) const;
+
+        size_t split_run(size_t source_offset);
+
+        void merge_runs(size_t index);
+
+        std::vector<OffsetRun> runs_;
+        size_t source_size_ = 0;
+        size_t destination_size_ = 0;
+    };
+}
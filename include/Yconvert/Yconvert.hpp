@@ -7,8 +7,17 @@
 //****************************************************************************
 #pragma once
 
+#include "ChunkConverter.hpp"
+#include "CodepointCursor.hpp"
+#include "CodepointIndex.hpp"
 #include "CodepointIterator.hpp"
+#include "CodepointView.hpp"
 #include "ConversionException.hpp"
+#include "DetectedStream.hpp"
 #include "Convert.hpp"
+#include "EncodedLength.hpp"
 #include "EncodingChecker.hpp"
+#include "EncodingDetection.hpp"
+#include "MappedFile.hpp"
+#include "OffsetMap.hpp"
 #include "YconvertVersion.hpp"
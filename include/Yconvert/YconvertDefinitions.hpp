@@ -57,4 +57,13 @@ namespace Yconvert
     #else
     constexpr size_t BUFFER_SIZE = 4 * 1024;
     #endif
+
+    /** @brief The default number of bytes that are read from a stream
+      *     at a time.
+      *
+      * Functions that read streams in chunks clamp the buffer size to the
+      * range [Details::InputStreamWrapper::MIN_CAPACITY,
+      * Details::InputStreamWrapper::MAX_CAPACITY].
+      */
+    constexpr size_t DEFAULT_STREAM_BUFFER_SIZE = 64 * 1024;
 }
@@ -0,0 +1,96 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/ChunkConverter.hpp"
+
+#include <algorithm>
+
+namespace Yconvert
+{
+    namespace
+    {
+        // The number of bytes moved from the next chunk to the carry at a
+        // time. It's more than enough to complete any character.
+        constexpr size_t CARRY_EXTENSION = 16;
+    }
+
+    ChunkConverter::ChunkConverter(Converter& converter, size_t buffer_size)
+        : converter_(converter),
+          buffer_(std::max(buffer_size, MIN_BUFFER_SIZE))
+    {}
+
+    Generator<std::span<const char>>
+    ChunkConverter::convert(std::span<const char> chunk)
+    {
+        return convert_chunk(chunk, false);
+    }
+
+    Generator<std::span<const char>> ChunkConverter::finish()
+    {
+        return convert_chunk({}, true);
+    }
+
+    size_t ChunkConverter::pending_size() const
+    {
+        return carry_.size();
+    }
+
+    Generator<std::span<const char>>
+    ChunkConverter::convert_chunk(std::span<const char> chunk, bool is_final)
+    {
+        auto src = chunk.data();
+        auto src_size = chunk.size();
+
+        // Complete the character that was split at the end of the previous
+        // chunk. Only a few bytes are copied from the current chunk, the
+        // rest is converted directly from the caller's memory.
+        while (!carry_.empty() && (src_size != 0 || is_final))
+        {
+            auto carry_size = carry_.size();
+            auto n = std::min(src_size, CARRY_EXTENSION);
+            carry_.insert(carry_.end(), src, src + n);
+            auto [r, w] = converter_.convert(carry_.data(), carry_.size(),
+                                             buffer_.data(), buffer_.size(),
+                                             is_final && n == src_size);
+            if (w != 0)
+                co_yield std::span<const char>(buffer_.data(), w);
+
+            if (r >= carry_size)
+            {
+                src += r - carry_size;
+                src_size -= r - carry_size;
+                carry_.clear();
+            }
+            else
+            {
+                carry_.erase(carry_.begin(), carry_.begin() + ptrdiff_t(r));
+                src += n;
+                src_size -= n;
+                if (r == 0 && w == 0 && n == 0)
+                    break;
+            }
+        }
+
+        while (src_size != 0)
+        {
+            auto [r, w] = converter_.convert(src, src_size,
+                                             buffer_.data(), buffer_.size(),
+                                             is_final);
+            if (w != 0)
+                co_yield std::span<const char>(buffer_.data(), w);
+            src += r;
+            src_size -= r;
+            if (r == 0 && w == 0)
+                break;
+        }
+
+        if (is_final)
+            carry_.clear();
+        else
+            carry_.insert(carry_.end(), src, src + src_size);
+    }
+}
@@ -0,0 +1,1042 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+// Generated by tools/codepages/make_model_file.py, do not edit.
+
+#include <cstddef>
+#include <cstdint>
+#include "Yconvert/Encoding.hpp"
+
+namespace Yconvert::Detail
+{
+    /**
+     * @brief The character classes that the bytes in each code page
+     *  are mapped to.
+     */
+    enum class CharClass : uint8_t
+    {
+        CONTROL = 0,
+        UNDEFINED = 1,
+        SPACE = 2,
+        DIGIT = 3,
+        PUNCTUATION = 4,
+        SYMBOL = 5,
+        ASCII_UPPER = 6,
+        ASCII_LOWER = 7,
+        LATIN_UPPER = 8,
+        LATIN_LOWER = 9,
+        LATIN_EXT_UPPER = 10,
+        LATIN_EXT_LOWER = 11,
+        LATIN_RARE = 12,
+        CYRILLIC_UPPER = 13,
+        CYRILLIC_LOWER = 14,
+        CYRILLIC_RARE = 15,
+        GREEK_UPPER = 16,
+        GREEK_LOWER = 17,
+        HEBREW = 18,
+        ARABIC = 19,
+        THAI = 20,
+        OTHER_LETTER = 21,
+    };
+
+    constexpr size_t CHAR_CLASS_COUNT = 22;
+
+    /**
+     * @brief The score of each pair of character classes. Positive
+     *  scores are for pairs that are common in text, negative scores for
+     *  pairs that are unlikely.
+     */
+    constexpr int8_t CHAR_CLASS_SCORES[CHAR_CLASS_COUNT][CHAR_CLASS_COUNT] = {
+        { -8, -10,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8,  -8}, // CONTROL
+        {-10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10}, // UNDEFINED
+        { -8, -10,   0,   0,   0,  -1,   1,   1,   1,   1,  -1,  -1,  -3,   1,   1,  -3,   1,   1,   1,   1,   1,  -3}, // SPACE
+        { -8, -10,   0,   0,   0,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1}, // DIGIT
+        { -8, -10,   0,   0,   0,  -1,   1,   1,   1,   1,  -1,  -1,  -3,   1,   1,  -3,   1,   1,   1,   1,   1,  -3}, // PUNCTUATION
+        { -8, -10,  -1,  -1,  -1,  -1,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3,  -3}, // SYMBOL
+        { -8, -10,   1,  -1,   1,  -3,   3,   3,   3,   3,   1,   1,  -1,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6}, // ASCII_UPPER
+        { -8, -10,   1,  -1,   1,  -3,  -1,   3,  -1,   3,  -3,   1,  -1,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6}, // ASCII_LOWER
+        { -8, -10,   1,  -1,   1,  -3,   3,   3,   3,   3,   1,   1,  -1,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6}, // LATIN_UPPER
+        { -8, -10,   1,  -1,   1,  -3,  -1,   3,  -1,   3,  -3,   1,  -1,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6}, // LATIN_LOWER
+        { -8, -10,  -1,  -1,  -1,  -3,   1,   1,   1,   1,   1,   1,  -1,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6}, // LATIN_EXT_UPPER
+        { -8, -10,  -1,  -1,  -1,  -3,  -3,   1,  -3,   1,  -3,   1,  -1,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6}, // LATIN_EXT_LOWER
+        { -8, -10,  -3,  -1,  -3,  -3,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6}, // LATIN_RARE
+        { -8, -10,   1,  -1,   1,  -3,  -6,  -6,  -6,  -6,  -6,  -6,  -6,   3,   3,  -1,  -6,  -6,  -6,  -6,  -6,  -6}, // CYRILLIC_UPPER
+        { -8, -10,   1,  -1,   1,  -3,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -1,   3,  -1,  -6,  -6,  -6,  -6,  -6,  -6}, // CYRILLIC_LOWER
+        { -8, -10,  -3,  -1,  -3,  -3,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -1,  -1,  -1,  -6,  -6,  -6,  -6,  -6,  -6}, // CYRILLIC_RARE
+        { -8, -10,   1,  -1,   1,  -3,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,   3,   3,  -6,  -6,  -6,  -6}, // GREEK_UPPER
+        { -8, -10,   1,  -1,   1,  -3,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -1,   3,  -6,  -6,  -6,  -6}, // GREEK_LOWER
+        { -8, -10,   1,  -1,   1,  -3,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,   3,  -6,  -6,  -6}, // HEBREW
+        { -8, -10,   1,  -1,   1,  -3,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,   3,  -6,  -6}, // ARABIC
+        { -8, -10,   1,  -1,   1,  -3,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,   3,  -6}, // THAI
+        { -8, -10,  -3,  -1,  -3,  -3,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -6,  -1}, // OTHER_LETTER
+    };
+
+    #ifdef YCONVERT_WIN_CODE_PAGES
+
+    constexpr uint8_t WIN_CP1250_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         5,  1,  4,  1,  4,  4,  4,  4,  1,  4, 10,  4, 10, 10, 10, 10,
+         1,  4,  4,  4,  4,  4,  4,  4,  1,  5, 11,  4, 11, 11, 11, 11,
+         2, 21,  5, 10,  5, 10,  5,  4,  5,  5, 10,  4,  5,  5,  5, 10,
+         5,  5,  5, 11,  5, 21,  4,  4,  5, 11, 11,  4, 10,  5, 11, 11,
+        10,  8,  8, 10,  8, 10, 10,  8, 10,  8, 10,  8, 10,  8,  8, 10,
+        10, 10, 10,  8,  8, 10,  8,  5, 10, 10,  8, 10,  8,  8, 10,  9,
+        11,  9,  9, 11,  9, 11, 11,  9, 11,  9, 11,  9, 11,  9,  9, 11,
+        11, 11, 11,  9,  9, 11,  9,  5, 11, 11,  9, 11,  9,  9, 11,  5
+    };
+
+    constexpr uint8_t WIN_CP1251_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+        13, 15,  4, 15,  4,  4,  4,  4,  5,  4, 13,  4, 13, 15, 13, 13,
+        14,  4,  4,  4,  4,  4,  4,  4,  1,  5, 14,  4, 14, 15, 14, 14,
+         2, 13, 14, 13,  5, 13,  5,  4, 13,  5, 13,  4,  5,  5,  5, 13,
+         5,  5, 13, 14, 14, 21,  4,  4, 14,  5, 14,  4, 14, 15, 15, 14,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14
+    };
+
+    constexpr uint8_t WIN_CP1252_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         5,  1,  4, 12,  4,  4,  4,  4, 21,  4, 10,  4,  8,  1, 10,  1,
+         1,  4,  4,  4,  4,  4,  4,  4,  5,  5, 11,  4,  9,  1, 11,  8,
+         2,  4,  5,  5,  5,  5,  5,  4,  5,  5, 21,  4,  5,  5,  5,  5,
+         5,  5,  5,  5,  5, 21,  4,  4,  5,  5, 21,  4,  5,  5,  5,  4,
+         8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+        10,  8,  8,  8,  8,  8,  8,  5,  8,  8,  8,  8,  8,  8, 10,  9,
+         9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+        11,  9,  9,  9,  9,  9,  9,  5,  9,  9,  9,  9,  9,  9, 11,  9
+    };
+
+    constexpr uint8_t WIN_CP1253_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         5,  1,  4, 12,  4,  4,  4,  4,  1,  4,  1,  4,  1,  1,  1,  1,
+         1,  4,  4,  4,  4,  4,  4,  4,  1,  5,  1,  4,  1,  1,  1,  1,
+         2,  5, 16,  5,  5,  5,  5,  4,  5,  5,  1,  4,  5,  5,  5,  4,
+         5,  5,  5,  5,  5, 21,  4,  4, 16, 16, 16,  4, 16,  5, 16, 16,
+        17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16,  1, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  1
+    };
+
+    constexpr uint8_t WIN_CP1254_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         5,  1,  4, 12,  4,  4,  4,  4, 21,  4, 10,  4,  8,  1,  1,  1,
+         1,  4,  4,  4,  4,  4,  4,  4,  5,  5, 11,  4,  9,  1,  1,  8,
+         2,  4,  5,  5,  5,  5,  5,  4,  5,  5, 21,  4,  5,  5,  5,  5,
+         5,  5,  5,  5,  5, 21,  4,  4,  5,  5, 21,  4,  5,  5,  5,  4,
+         8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+        10,  8,  8,  8,  8,  8,  8,  5,  8,  8,  8,  8,  8, 12, 10,  9,
+         9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+        11,  9,  9,  9,  9,  9,  9,  5,  9,  9,  9,  9,  9, 11, 11,  9
+    };
+
+    constexpr uint8_t WIN_CP1255_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         5,  1,  4, 12,  4,  4,  4,  4, 21,  4,  1,  4,  1,  1,  1,  1,
+         1,  4,  4,  4,  4,  4,  4,  4,  5,  5,  1,  4,  1,  1,  1,  1,
+         2,  4,  5,  5,  5,  5,  5,  4,  5,  5,  5,  4,  5,  5,  5,  5,
+         5,  5,  5,  5,  5, 21,  4,  4,  5,  5,  5,  4,  5,  5,  5,  4,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  1, 18, 18, 18,  4, 18,
+         4, 18, 18,  4, 18, 18, 18,  4,  4,  1,  1,  1,  1,  1,  1,  1,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  1,  1,  5,  5,  1
+    };
+
+    constexpr uint8_t WIN_CP1256_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         5, 19,  4, 12,  4,  4,  4,  4, 21,  4, 19,  4,  8, 19, 19, 19,
+        19,  4,  4,  4,  4,  4,  4,  4, 19,  5, 19,  4,  9,  5,  5, 19,
+         2,  4,  5,  5,  5,  5,  5,  4,  5,  5, 19,  4,  5,  5,  5,  5,
+         5,  5,  5,  5,  5, 21,  4,  4,  5,  5,  4,  4,  5,  5,  5,  4,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19,  5, 19, 19, 19, 19, 19, 19, 19, 19,
+         9, 19,  9, 19, 19, 19, 19,  9,  9,  9,  9,  9, 19, 19,  9,  9,
+        19, 19, 19, 19,  9, 19, 19,  5, 19,  9, 19,  9,  9,  5,  5, 19
+    };
+
+    constexpr uint8_t WIN_CP1257_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         5,  1,  4,  1,  4,  4,  4,  4,  1,  4,  1,  4,  1,  5, 21,  5,
+         1,  4,  4,  4,  4,  4,  4,  4,  1,  5,  1,  4,  1,  5,  5,  1,
+         2,  1,  5,  5,  5,  1,  5,  4,  8,  5, 12,  4,  5,  5,  5,  8,
+         5,  5,  5,  5,  5, 21,  4,  4,  9,  5, 12,  4,  5,  5,  5,  9,
+        10, 10, 10, 10,  8,  8, 10, 10, 10,  8, 10, 10, 10, 10, 10, 10,
+        10, 10, 10,  8, 12,  8,  8,  5, 10, 10, 10, 10,  8, 10, 10,  9,
+        11, 11, 11, 11,  9,  9, 11, 11, 11,  9, 11, 11, 11, 11, 11, 11,
+        11, 11, 11,  9, 12,  9,  9,  5, 11, 11, 11, 11,  9, 11, 11,  5
+    };
+
+    constexpr uint8_t WIN_CP1258_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         5,  1,  4, 12,  4,  4,  4,  4, 21,  4,  1,  4,  8,  1,  1,  1,
+         1,  4,  4,  4,  4,  4,  4,  4,  5,  5,  1,  4,  9,  1,  1,  8,
+         2,  4,  5,  5,  5,  5,  5,  4,  5,  5, 21,  4,  5,  5,  5,  5,
+         5,  5,  5,  5,  5, 21,  4,  4,  5,  5, 21,  4,  5,  5,  5,  4,
+         8,  8,  8, 10,  8,  8,  8,  8,  8,  8,  8,  8, 21,  8,  8,  8,
+        10,  8, 21,  8,  8, 12,  8,  5,  8,  8,  8,  8,  8, 12, 21,  9,
+         9,  9,  9, 11,  9,  9,  9,  9,  9,  9,  9,  9, 21,  9,  9,  9,
+        11,  9, 21,  9,  9, 12,  9,  5,  9,  9,  9,  9,  9, 12,  5,  9
+    };
+
+    #endif
+
+    #ifdef YCONVERT_ISO_CODE_PAGES
+
+    constexpr uint8_t ISO_8859_1_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  5,  5,  5,  5,  5,  4,  5,  5, 21,  4,  5,  5,  5,  5,
+         5,  5,  5,  5,  5, 21,  4,  4,  5,  5, 21,  4,  5,  5,  5,  4,
+         8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+        10,  8,  8,  8,  8,  8,  8,  5,  8,  8,  8,  8,  8,  8, 10,  9,
+         9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+        11,  9,  9,  9,  9,  9,  9,  5,  9,  9,  9,  9,  9,  9, 11,  9
+    };
+
+    constexpr uint8_t ISO_8859_2_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2, 10,  5, 10,  5, 10, 10,  4,  5, 10, 10, 10, 10,  5, 10, 10,
+         5, 11,  5, 11,  5, 11, 11, 21,  5, 11, 11, 11, 11,  5, 11, 11,
+        10,  8,  8, 10,  8, 10, 10,  8, 10,  8, 10,  8, 10,  8,  8, 10,
+        10, 10, 10,  8,  8, 10,  8,  5, 10, 10,  8, 10,  8,  8, 10,  9,
+        11,  9,  9, 11,  9, 11, 11,  9, 11,  9, 11,  9, 11,  9,  9, 11,
+        11, 11, 11,  9,  9, 11,  9,  5, 11, 11,  9, 11,  9,  9, 11,  5
+    };
+
+    constexpr uint8_t ISO_8859_3_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2, 12,  5,  5,  5,  1, 12,  4,  5, 12, 10, 10, 12,  5,  1, 10,
+         5, 12,  5,  5,  5, 21, 12,  4,  5, 11, 11, 11, 12,  5,  1, 11,
+         8,  8,  8,  1,  8, 12, 12,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+         1,  8,  8,  8,  8, 12,  8,  5, 12,  8,  8,  8,  8, 12, 12,  9,
+         9,  9,  9,  1,  9, 12, 12,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+         1,  9,  9,  9,  9, 12,  9,  5, 12,  9,  9,  9,  9, 12, 12,  5
+    };
+
+    constexpr uint8_t ISO_8859_4_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2, 10, 12, 12,  5, 12, 10,  4,  5, 10, 10, 10, 12,  5, 10,  5,
+         5, 11,  5, 12,  5, 12, 11, 21,  5, 11, 11, 11, 12, 12, 11, 12,
+        10,  8,  8,  8,  8,  8,  8, 10, 10,  8, 10,  8, 10,  8,  8, 10,
+        10, 10, 12, 10,  8,  8,  8,  5,  8, 10,  8,  8,  8, 12, 10,  9,
+        11,  9,  9,  9,  9,  9,  9, 11, 11,  9, 11,  9, 11,  9,  9, 11,
+        11, 11, 12, 11,  9,  9,  9,  5,  9, 11,  9,  9,  9, 12, 11,  5
+    };
+
+    constexpr uint8_t ISO_8859_5_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2, 13, 13, 15, 13, 15, 13, 13, 13, 13, 13, 13, 15,  5, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+         5, 14, 14, 15, 14, 15, 14, 14, 14, 14, 14, 14, 15,  4, 14, 14
+    };
+
+    constexpr uint8_t ISO_8859_6_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  1,  1,  1,  5,  1,  1,  1,  1,  1,  1,  1,  4,  5,  1,  1,
+         1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  4,  1,  1,  1,  4,
+         1, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,  1,  1,  1,  1,  1,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1
+    };
+
+    constexpr uint8_t ISO_8859_7_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  5,  5,  5,  5,  4,  5,  5, 17,  4,  5,  5,  1,  4,
+         5,  5,  5,  5,  5,  5, 16,  4, 16, 16, 16,  4, 16,  5, 16, 16,
+        17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16,  1, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  1
+    };
+
+    constexpr uint8_t ISO_8859_8_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  1,  5,  5,  5,  5,  5,  4,  5,  5,  5,  4,  5,  5,  5,  5,
+         5,  5,  5,  5,  5, 21,  4,  4,  5,  5,  5,  4,  5,  5,  5,  1,
+         1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+         1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  4,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  1,  1,  5,  5,  1
+    };
+
+    constexpr uint8_t ISO_8859_9_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  5,  5,  5,  5,  5,  4,  5,  5, 21,  4,  5,  5,  5,  5,
+         5,  5,  5,  5,  5, 21,  4,  4,  5,  5, 21,  4,  5,  5,  5,  4,
+         8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+        10,  8,  8,  8,  8,  8,  8,  5,  8,  8,  8,  8,  8, 12, 10,  9,
+         9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+        11,  9,  9,  9,  9,  9,  9,  5,  9,  9,  9,  9,  9, 11, 11,  9
+    };
+
+    constexpr uint8_t ISO_8859_10_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2, 10, 10, 10, 10, 12, 10,  4, 10, 10, 10, 12, 10,  5, 10, 12,
+         5, 11, 11, 11, 11, 12, 11,  4, 11, 11, 11, 12, 11,  4, 11, 12,
+        10,  8,  8,  8,  8,  8,  8, 10, 10,  8, 10,  8, 10,  8,  8,  8,
+        10, 10, 12,  8,  8,  8,  8, 12,  8, 10,  8,  8,  8,  8, 10,  9,
+        11,  9,  9,  9,  9,  9,  9, 11, 11,  9, 11,  9, 11,  9,  9,  9,
+        11, 11, 12,  9,  9,  9,  9, 12,  9, 11,  9,  9,  9,  9, 11, 12
+    };
+
+    constexpr uint8_t ISO_8859_11_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,  1,  1,  1,  1,  5,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  1,  1,  1,  1
+    };
+
+    constexpr uint8_t ISO_8859_13_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  5,  5,  5,  4,  5,  4,  8,  5, 12,  4,  5,  5,  5,  8,
+         5,  5,  5,  5,  4, 21,  4,  4,  9,  5, 12,  4,  5,  5,  5,  9,
+        10, 10, 10, 10,  8,  8, 10, 10, 10,  8, 10, 10, 10, 10, 10, 10,
+        10, 10, 10,  8, 12,  8,  8,  5, 10, 10, 10, 10,  8, 10, 10,  9,
+        11, 11, 11, 11,  9,  9, 11, 11, 11,  9, 11, 11, 11, 11, 11, 11,
+        11, 11, 11,  9, 12,  9,  9,  5, 11, 11, 11, 11,  9, 11, 11,  4
+    };
+
+    constexpr uint8_t ISO_8859_14_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2, 12, 12,  5, 12, 12, 12,  4, 10,  5, 10, 12, 12,  5,  5,  8,
+        12, 12, 12, 12, 12, 12,  4, 12, 11, 12, 11, 12, 12, 12, 12, 12,
+         8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+        10,  8,  8,  8,  8,  8,  8, 12,  8,  8,  8,  8,  8,  8, 10,  9,
+         9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+        11,  9,  9,  9,  9,  9,  9, 12,  9,  9,  9,  9,  9,  9, 11,  9
+    };
+
+    constexpr uint8_t ISO_8859_15_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  5,  5,  5,  5, 10,  4, 11,  5, 21,  4,  5,  5,  5,  5,
+         5,  5,  5,  5, 10, 21,  4,  4, 11,  5, 21,  4,  8,  9,  8,  4,
+         8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+        10,  8,  8,  8,  8,  8,  8,  5,  8,  8,  8,  8,  8,  8, 10,  9,
+         9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+        11,  9,  9,  9,  9,  9,  9,  5,  9,  9,  9,  9,  9,  9, 11,  9
+    };
+
+    constexpr uint8_t ISO_8859_16_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2, 10, 11, 10,  5,  4, 10,  4, 11,  5, 10,  4, 10,  5, 11, 10,
+         5,  5, 10, 11, 10,  4,  4,  4, 11, 11, 11,  4,  8,  9,  8, 11,
+         8,  8,  8, 10,  8, 10,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+        10, 10,  8,  8,  8, 10,  8, 10, 10,  8,  8,  8,  8, 10, 10,  9,
+         9,  9,  9, 11,  9, 11,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+        11, 11,  9,  9,  9, 11,  9, 11, 11,  9,  9,  9,  9, 11, 11,  9
+    };
+
+    #endif
+
+    #ifdef YCONVERT_DOS_CODE_PAGES
+
+    constexpr uint8_t DOS_CP437_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  8,  8,
+         8,  9,  8,  9,  9,  9,  9,  9,  9,  8,  8,  5,  5,  5,  5, 12,
+         9,  9,  9,  9,  9,  8, 21, 21,  4,  5,  5,  5,  5,  4,  4,  4,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+        17,  9, 16, 17, 16, 17, 21, 17, 16, 16, 16, 17,  5, 17, 17,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  4,  5, 21,  5,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP737_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16,
+        16,  5,  5,  5, 16, 16,  5,  5,  5,  5,  4,  5, 21,  5,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP775_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+        10,  9,  9, 11,  9, 11,  9, 11, 11, 11, 12, 12, 11, 10,  8,  8,
+         8,  9,  8, 12,  9, 10,  5, 10, 11,  8,  8,  9,  5,  8,  5,  5,
+        10, 10,  9, 10, 11, 11,  4,  5,  5,  5,  5,  5,  5, 10,  4,  4,
+         5,  5,  5,  5,  5, 10, 10, 10, 10,  5,  5,  5,  5, 10, 10,  5,
+         5,  5,  5,  5,  5,  5, 10, 10,  5,  5,  5,  5,  5,  5,  5, 10,
+        11, 11, 11, 11, 11, 11, 11, 11, 11,  5,  5,  5,  5,  5,  5,  5,
+         8,  9, 12, 10,  9,  8, 21, 11, 10, 11, 10, 11, 11, 10, 10,  4,
+         5,  5,  4,  5,  4,  4,  5,  4,  5,  5,  4,  5,  5,  5,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP850_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  8,  8,
+         8,  9,  8,  9,  9,  9,  9,  9,  9,  8,  8,  9,  5,  8,  5, 12,
+         9,  9,  9,  9,  9,  8, 21, 21,  4,  5,  5,  5,  5,  4,  4,  4,
+         5,  5,  5,  5,  5,  8,  8,  8,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  9,  8,  5,  5,  5,  5,  5,  5,  5,  5,
+        11, 10,  8,  8,  8, 11,  8,  8,  8,  5,  5,  5,  5,  5,  8,  5,
+         8,  9,  8,  8,  9,  8, 21, 11, 10,  8,  8,  8,  9,  8,  5,  5,
+         5,  5,  4,  5,  4,  4,  5,  5,  5,  5,  4,  5,  5,  5,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP852_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  9,  9,  9,  9, 11, 11,  9, 11,  9, 10, 11,  9, 10,  8, 10,
+         8, 10, 11,  9,  9, 10, 11, 10, 11,  8,  8, 10, 11, 10,  5, 11,
+         9,  9,  9,  9, 10, 11, 10, 11, 10, 11,  5, 11, 10, 11,  4,  4,
+         5,  5,  5,  5,  5,  8,  8, 10, 10,  5,  5,  5,  5, 10, 11,  5,
+         5,  5,  5,  5,  5,  5, 10, 11,  5,  5,  5,  5,  5,  5,  5,  5,
+        11, 10, 10,  8, 11, 10,  8,  8, 11,  5,  5,  5,  5, 10, 10,  5,
+         8,  9,  8, 10, 11, 11, 10, 11, 10,  8, 11, 10,  9,  8, 11,  5,
+         5,  5,  5, 21,  5,  4,  5,  5,  5,  5,  5, 11, 10, 11,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP855_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+        14, 13, 15, 15, 14, 13, 14, 13, 15, 15, 14, 13, 14, 13, 14, 13,
+        14, 13, 14, 13, 14, 13, 15, 15, 14, 13, 14, 13, 14, 13, 14, 13,
+        14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13,  4,  4,
+         5,  5,  5,  5,  5, 14, 13, 14, 13,  5,  5,  5,  5, 14, 13,  5,
+         5,  5,  5,  5,  5,  5, 14, 13,  5,  5,  5,  5,  5,  5,  5,  5,
+        14, 13, 14, 13, 14, 13, 14, 13, 14,  5,  5,  5,  5, 13, 14,  5,
+        13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13,  5,
+         5, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13,  4,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP857_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9, 11,  8,  8,
+         8,  9,  8,  9,  9,  9,  9,  9, 12,  8,  8,  9,  5,  8, 10, 11,
+         9,  9,  9,  9,  9,  8, 10, 11,  4,  5,  5,  5,  5,  4,  4,  4,
+         5,  5,  5,  5,  5,  8,  8,  8,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  9,  8,  5,  5,  5,  5,  5,  5,  5,  5,
+        21, 21,  8,  8,  8,  1,  8,  8,  8,  5,  5,  5,  5,  5,  8,  5,
+         8,  9,  8,  8,  9,  8, 21,  1,  5,  8,  8,  8,  9,  9,  5,  5,
+         5,  5,  1,  5,  4,  4,  5,  5,  5,  5,  4,  5,  5,  5,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP860_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  9,  9,  9,  9,  9,  8,  9,  9,  8,  9,  8,  8,  9,  8,  8,
+         8,  8,  8,  9,  9,  9,  8,  9,  8,  8,  8,  5,  5,  8,  5,  8,
+         9,  9,  9,  9,  9,  8, 21, 21,  4,  8,  5,  5,  5,  4,  4,  4,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+        17,  9, 16, 17, 16, 17, 21, 17, 16, 16, 16, 17,  5, 17, 17,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  4,  5, 21,  5,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP861_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9, 10, 11, 10,  8,  8,
+         8,  9,  8,  9,  9, 11,  9,  8,  9,  8,  8,  9,  5,  8,  5, 12,
+         9,  9,  9,  9,  8,  8,  8,  8,  4,  5,  5,  5,  5,  4,  4,  4,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+        17,  9, 16, 17, 16, 17, 21, 17, 16, 16, 16, 17,  5, 17, 17,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  4,  5, 21,  5,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP862_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  5,  5,  5,  5, 12,
+         9,  9,  9,  9,  9,  8, 21, 21,  4,  5,  5,  5,  5,  4,  4,  4,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+        17,  9, 16, 17, 16, 17, 21, 17, 16, 16, 16, 17,  5, 17, 17,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  4,  5, 21,  5,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP863_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  9,  9,  9,  8,  9,  4,  9,  9,  9,  9,  9,  9,  4,  8,  4,
+         8,  8,  8,  9,  8,  8,  9,  9,  5,  8,  8,  5,  5,  8,  8, 12,
+         5,  5,  9,  9,  5,  5,  5,  5,  8,  5,  5,  5,  5,  5,  4,  4,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+        17,  9, 16, 17, 16, 17, 21, 17, 16, 16, 16, 17,  5, 17, 17,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  4,  5, 21,  5,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP864_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         5,  4,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+        17,  5, 17,  5,  5,  5,  5,  4,  4, 19, 19,  1,  1, 19, 19,  1,
+         2,  5, 19,  5,  5, 19,  1,  1, 19, 19, 19, 19,  4, 19, 19, 19,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3, 19,  4, 19, 19, 19,  4,
+         5, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,  5,  5,  5,  5, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,  5,  1
+    };
+
+    constexpr uint8_t DOS_CP865_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  8,  8,
+         8,  9,  8,  9,  9,  9,  9,  9,  9,  8,  8,  9,  5,  8,  5, 12,
+         9,  9,  9,  9,  9,  8, 21, 21,  4,  5,  5,  5,  5,  4,  4,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+        17,  9, 16, 17, 16, 17, 21, 17, 16, 16, 16, 17,  5, 17, 17,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  4,  5, 21,  5,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP866_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+         5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        13, 14, 13, 14, 13, 14, 13, 14,  5,  5,  4,  5,  5,  5,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP869_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         1,  1,  1,  1,  1,  1, 16,  1,  4,  5,  5,  4,  4, 16,  4, 16,
+        16, 16, 16,  1,  1, 16, 16,  5, 16,  5,  5, 17,  5, 17, 17, 17,
+        17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 16,  5, 16, 16,  4,  4,
+         5,  5,  5,  5,  5, 16, 16, 16, 16,  5,  5,  5,  5, 16, 16,  5,
+         5,  5,  5,  5,  5,  5, 16, 16,  5,  5,  5,  5,  5,  5,  5, 16,
+        16, 16, 16, 16, 16, 16, 17, 17, 17,  5,  5,  5,  5, 17, 17,  5,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  5,
+         5,  5, 17, 17, 17,  4, 17,  5,  5,  5, 17, 17, 17, 17,  5,  2
+    };
+
+    constexpr uint8_t DOS_CP874_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         5,  1,  1,  1,  1,  4,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+         1,  4,  4,  4,  4,  4,  4,  4,  1,  1,  1,  1,  1,  1,  1,  1,
+         2, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,  1,  1,  1,  1,  5,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  1,  1,  1,  1
+    };
+
+    #endif
+
+    #ifdef YCONVERT_MAC_CODE_PAGES
+
+    constexpr uint8_t MAC_CYRILLIC_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+         4,  5,  5,  5,  4,  4,  4, 13,  5,  5,  5, 13, 14,  5, 15, 15,
+         5,  5,  5,  5, 14, 21,  5, 13, 13, 14, 13, 14, 13, 14, 13, 14,
+        14, 15,  5,  5, 12,  5,  5,  4,  4,  4,  2, 13, 14, 15, 15, 15,
+         4,  4,  4,  4,  4,  4,  5,  4, 13, 14, 13, 14,  5, 13, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  5
+    };
+
+    constexpr uint8_t MAC_GREEK_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  5,  5,  8,  5,  8,  8,  5,  9,  9,  9,  5,  5,  9,  9,  9,
+         9,  9,  5,  5,  9,  9,  4,  5,  4,  9,  9,  5,  5,  9,  9,  9,
+         4, 16, 16, 16, 16, 16, 16,  9,  5,  5, 16, 16,  4,  5,  5,  4,
+        16,  5,  5,  5,  5, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        17, 16,  5, 16, 16,  5, 16,  4,  4,  4,  2, 16, 16, 16, 16,  9,
+         4,  4,  4,  4,  4,  4,  5, 16, 16, 16, 16, 17, 17, 17, 17, 16,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,  1
+    };
+
+    constexpr uint8_t MAC_ICELAND_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  8,  8,  8,  8,  8,  8,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+         9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+         8,  5,  5,  5,  4,  4,  4,  9,  5,  5,  5,  5,  5,  5,  8,  8,
+         5,  5,  5,  5,  5, 21,  5,  5,  5, 17,  5, 21, 21, 21,  9,  9,
+         4,  4,  5,  5, 12,  5,  5,  4,  4,  4,  2,  8,  8,  8,  8,  9,
+         4,  4,  4,  4,  4,  4,  5,  5,  9,  8,  5,  5, 10, 11, 10, 11,
+         9,  4,  4,  4,  4,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+         1,  8,  8,  8,  8, 11, 21,  5,  5,  5,  5,  5,  5,  5,  5, 21
+    };
+
+    constexpr uint8_t MAC_LATIN2_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8, 10, 11,  8, 10,  8,  8,  9, 11, 10,  9, 11, 10, 11,  9, 10,
+        11, 10,  9, 11, 10, 11, 10,  9, 11,  9,  9,  9,  9, 10, 11,  9,
+         4,  5, 10,  5,  4,  4,  4,  9,  5,  5,  5, 11,  5,  5, 11, 10,
+        11, 10,  5,  5, 11, 10,  5,  5, 11, 10, 11, 10, 11, 10, 11, 10,
+        11, 10,  5,  5, 11, 10,  5,  4,  4,  4,  2, 11, 10,  8, 11, 12,
+         4,  4,  4,  4,  4,  4,  5,  5, 12, 10, 11, 10,  4,  4, 11, 12,
+        12, 10,  4,  4, 11, 10, 11,  8, 10, 11,  8, 10, 11, 10,  8,  8,
+        11, 10,  8, 11, 10, 11, 10, 11,  8,  9, 11, 10, 10, 11, 10, 21
+    };
+
+    constexpr uint8_t MAC_ROMAN_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  8,  8,  8,  8,  8,  8,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+         9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+         4,  5,  5,  5,  4,  4,  4,  9,  5,  5,  5,  5,  5,  5,  8,  8,
+         5,  5,  5,  5,  5, 21,  5,  5,  5, 17,  5, 21, 21, 21,  9,  9,
+         4,  4,  5,  5, 12,  5,  5,  4,  4,  4,  2,  8,  8,  8,  8,  9,
+         4,  4,  4,  4,  4,  4,  5,  5,  9,  8,  5,  5,  4,  4, 12, 12,
+         4,  4,  4,  4,  4,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+         1,  8,  8,  8,  8, 11, 21,  5,  5,  5,  5,  5,  5,  5,  5, 21
+    };
+
+    constexpr uint8_t MAC_TURKISH_CLASSES[256] = {
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+         2,  4,  4,  4,  5,  4,  4,  4,  4,  4,  4,  5,  4,  4,  4,  4,
+         3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  5,  5,  5,  4,
+         4,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  4,  4,  4,  5,  4,
+         5,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+         7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  4,  5,  4,  5,  0,
+         8,  8,  8,  8,  8,  8,  8,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+         9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+         4,  5,  5,  5,  4,  4,  4,  9,  5,  5,  5,  5,  5,  5,  8,  8,
+         5,  5,  5,  5,  5, 21,  5,  5,  5, 17,  5, 21, 21, 21,  9,  9,
+         4,  4,  5,  5, 12,  5,  5,  4,  4,  4,  2,  8,  8,  8,  8,  9,
+         4,  4,  4,  4,  4,  4,  5,  5,  9,  8, 10, 11, 12, 11, 10, 11,
+         4,  4,  4,  4,  4,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+         1,  8,  8,  8,  8,  1, 21,  5,  5,  5,  5,  5,  5,  5,  5, 21
+    };
+
+    #endif
+
+    /**
+     * @brief A code page and the character classes of its 256 bytes.
+     */
+    struct CodePageModel
+    {
+        Encoding encoding;
+        const uint8_t* classes;
+    };
+
+    /**
+     * @brief The models of the code pages that are compiled in, ordered
+     *  by how common the code pages are. The last model is a sentinel
+     *  with Encoding::UNKNOWN.
+     */
+    constexpr CodePageModel CODE_PAGE_MODELS[] = {
+        #ifdef YCONVERT_WIN_CODE_PAGES
+        {Encoding::WIN_CP1250, WIN_CP1250_CLASSES},
+        {Encoding::WIN_CP1251, WIN_CP1251_CLASSES},
+        {Encoding::WIN_CP1252, WIN_CP1252_CLASSES},
+        {Encoding::WIN_CP1253, WIN_CP1253_CLASSES},
+        {Encoding::WIN_CP1254, WIN_CP1254_CLASSES},
+        {Encoding::WIN_CP1255, WIN_CP1255_CLASSES},
+        {Encoding::WIN_CP1256, WIN_CP1256_CLASSES},
+        {Encoding::WIN_CP1257, WIN_CP1257_CLASSES},
+        {Encoding::WIN_CP1258, WIN_CP1258_CLASSES},
+        #endif
+        #ifdef YCONVERT_ISO_CODE_PAGES
+        {Encoding::ISO_8859_1, ISO_8859_1_CLASSES},
+        {Encoding::ISO_8859_2, ISO_8859_2_CLASSES},
+        {Encoding::ISO_8859_3, ISO_8859_3_CLASSES},
+        {Encoding::ISO_8859_4, ISO_8859_4_CLASSES},
+        {Encoding::ISO_8859_5, ISO_8859_5_CLASSES},
+        {Encoding::ISO_8859_6, ISO_8859_6_CLASSES},
+        {Encoding::ISO_8859_7, ISO_8859_7_CLASSES},
+        {Encoding::ISO_8859_8, ISO_8859_8_CLASSES},
+        {Encoding::ISO_8859_9, ISO_8859_9_CLASSES},
+        {Encoding::ISO_8859_10, ISO_8859_10_CLASSES},
+        {Encoding::ISO_8859_11, ISO_8859_11_CLASSES},
+        {Encoding::ISO_8859_13, ISO_8859_13_CLASSES},
+        {Encoding::ISO_8859_14, ISO_8859_14_CLASSES},
+        {Encoding::ISO_8859_15, ISO_8859_15_CLASSES},
+        {Encoding::ISO_8859_16, ISO_8859_16_CLASSES},
+        #endif
+        #ifdef YCONVERT_DOS_CODE_PAGES
+        {Encoding::DOS_CP437, DOS_CP437_CLASSES},
+        {Encoding::DOS_CP737, DOS_CP737_CLASSES},
+        {Encoding::DOS_CP775, DOS_CP775_CLASSES},
+        {Encoding::DOS_CP850, DOS_CP850_CLASSES},
+        {Encoding::DOS_CP852, DOS_CP852_CLASSES},
+        {Encoding::DOS_CP855, DOS_CP855_CLASSES},
+        {Encoding::DOS_CP857, DOS_CP857_CLASSES},
+        {Encoding::DOS_CP860, DOS_CP860_CLASSES},
+        {Encoding::DOS_CP861, DOS_CP861_CLASSES},
+        {Encoding::DOS_CP862, DOS_CP862_CLASSES},
+        {Encoding::DOS_CP863, DOS_CP863_CLASSES},
+        {Encoding::DOS_CP864, DOS_CP864_CLASSES},
+        {Encoding::DOS_CP865, DOS_CP865_CLASSES},
+        {Encoding::DOS_CP866, DOS_CP866_CLASSES},
+        {Encoding::DOS_CP869, DOS_CP869_CLASSES},
+        {Encoding::DOS_CP874, DOS_CP874_CLASSES},
+        #endif
+        #ifdef YCONVERT_MAC_CODE_PAGES
+        {Encoding::MAC_CYRILLIC, MAC_CYRILLIC_CLASSES},
+        {Encoding::MAC_GREEK, MAC_GREEK_CLASSES},
+        {Encoding::MAC_ICELAND, MAC_ICELAND_CLASSES},
+        {Encoding::MAC_LATIN2, MAC_LATIN2_CLASSES},
+        {Encoding::MAC_ROMAN, MAC_ROMAN_CLASSES},
+        {Encoding::MAC_TURKISH, MAC_TURKISH_CLASSES},
+        #endif
+        {Encoding::UNKNOWN, nullptr}
+    };
+}
+
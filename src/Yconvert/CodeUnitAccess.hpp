@@ -0,0 +1,95 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstring>
+#include "Yconvert/Endian.hpp"
+#include "SimdDefinitions.hpp"
+
+/** @file
+  * @brief Unaligned loads and stores of UTF-16 and UTF-32 code units in
+  *     either byte order, shared by the UTF-16 and UTF-32 algorithms.
+  */
+
+namespace Yconvert::Detail
+{
+    template <bool SWAP_BYTES>
+    char16_t load_utf16_word(const char* src)
+    {
+        char16_t w;
+        memcpy(&w, src, sizeof(w));
+        if constexpr (SWAP_BYTES)
+            w = char16_t((w << 8u) | (w >> 8u));
+        return w;
+    }
+
+    template <bool SWAP_BYTES>
+    char32_t load_utf32_word(const char* src)
+    {
+        char32_t w;
+        memcpy(&w, src, sizeof(w));
+        if constexpr (SWAP_BYTES)
+            w = reverse_bytes(w);
+        return w;
+    }
+
+    template <bool SWAP_BYTES>
+    void store_utf16_word(char16_t w, char* dst)
+    {
+        if constexpr (SWAP_BYTES)
+            w = char16_t((w << 8u) | (w >> 8u));
+        memcpy(dst, &w, sizeof(w));
+    }
+
+    template <bool SWAP_BYTES>
+    void store_utf32_word(char32_t w, char* dst)
+    {
+        if constexpr (SWAP_BYTES)
+            w = reverse_bytes(w);
+        memcpy(dst, &w, sizeof(w));
+    }
+
+#ifdef YCONVERT_SSE2
+
+    inline __m128i swap_bytes_epi16(__m128i v)
+    {
+        return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    }
+
+    /**
+     * @brief Reverses the bytes in each 32-bit lane of @a v.
+     *
+     * Swaps the bytes in each 16-bit half, then the halves, which gives
+     * the same result as a byte shuffle without requiring SSSE3.
+     */
+    inline __m128i swap_bytes_epi32(__m128i v)
+    {
+        v = swap_bytes_epi16(v);
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        return _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+
+    template <bool SWAP_BYTES>
+    __m128i load_utf16(const char* src)
+    {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        if constexpr (SWAP_BYTES)
+            v = swap_bytes_epi16(v);
+        return v;
+    }
+
+    template <bool SWAP_BYTES>
+    __m128i load_utf32(const char* src)
+    {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        if constexpr (SWAP_BYTES)
+            v = swap_bytes_epi32(v);
+        return v;
+    }
+
+#endif
+}
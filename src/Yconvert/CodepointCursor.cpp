@@ -0,0 +1,205 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/CodepointCursor.hpp"
+
+#include <algorithm>
+#include "Utf8Decoder.hpp"
+#include "Utf16Decoder.hpp"
+#include "Utf32Decoder.hpp"
+#include "YconvertThrow.hpp"
+
+namespace Yconvert
+{
+    namespace
+    {
+        /**
+         * @brief A code point and the number of bytes it occupies.
+         */
+        struct Step
+        {
+            char32_t value;
+            size_t size;
+        };
+
+        constexpr bool is_utf8_continuation(char c)
+        {
+            return (uint8_t(c) & 0xC0u) == 0x80;
+        }
+
+        Step next_utf8(const char* pos, const char* end)
+        {
+            auto it = pos;
+            auto c = Detail::next_utf8_value(it, end);
+            if (c == INVALID_CHAR)
+                return {REPLACEMENT_CHARACTER, 1};
+            return {c, size_t(it - pos)};
+        }
+
+        Step prev_utf8(const char* begin, const char* pos)
+        {
+            auto start = pos - 1;
+            while (start != begin && pos - start < 4 && is_utf8_continuation(*start))
+                --start;
+            if (auto step = next_utf8(start, pos); step.size == size_t(pos - start))
+                return step;
+            return {REPLACEMENT_CHARACTER, 1};
+        }
+
+        template <bool SWAP_BYTES>
+        Step next_utf16(const char* pos, const char* end)
+        {
+            auto it = pos;
+            auto c = Detail::next_utf16_code_point<SWAP_BYTES>(it, end);
+            if (c == INVALID_CHAR)
+                return {REPLACEMENT_CHARACTER, std::min<size_t>(end - pos, 2)};
+            return {c, size_t(it - pos)};
+        }
+
+        template <bool SWAP_BYTES>
+        Step prev_utf16(const char* begin, const char* pos)
+        {
+            // An odd number of bytes can only occur at the end of the
+            // buffer, where the last byte is an incomplete code unit.
+            if ((pos - begin) % 2 != 0)
+                return {REPLACEMENT_CHARACTER, 1};
+
+            if (pos - begin >= 4)
+            {
+                auto it = pos - 2;
+                auto low = Detail::next_utf16_word<SWAP_BYTES>(it, pos);
+                if (0xDC00 <= low && low < 0xE000)
+                {
+                    if (auto step = next_utf16<SWAP_BYTES>(pos - 4, pos); step.size == 4)
+                        return step;
+                }
+            }
+
+            if (auto step = next_utf16<SWAP_BYTES>(pos - 2, pos); step.size == 2)
+                return step;
+            return {REPLACEMENT_CHARACTER, 2};
+        }
+
+        template <bool SWAP_BYTES>
+        Step next_utf32(const char* pos, const char* end)
+        {
+            auto it = pos;
+            auto c = Detail::next_utf32_code_point<SWAP_BYTES>(it, end);
+            if (c == INVALID_CHAR)
+                return {REPLACEMENT_CHARACTER, std::min<size_t>(end - pos, 4)};
+            return {c, 4};
+        }
+
+        template <bool SWAP_BYTES>
+        Step prev_utf32(const char* begin, const char* pos)
+        {
+            // An incomplete code unit can only occur at the end of the buffer.
+            if (auto rest = size_t(pos - begin) % 4; rest != 0)
+                return {REPLACEMENT_CHARACTER, rest};
+            return next_utf32<SWAP_BYTES>(pos - 4, pos);
+        }
+
+        Step next_step(Encoding encoding, const char* pos, const char* end)
+        {
+            switch (encoding)
+            {
+            case Encoding::UTF_8:
+                return next_utf8(pos, end);
+            case Encoding::UTF_16_BE:
+                return next_utf16<IS_LITTLE_ENDIAN>(pos, end);
+            case Encoding::UTF_16_LE:
+                return next_utf16<IS_BIG_ENDIAN>(pos, end);
+            case Encoding::UTF_32_BE:
+                return next_utf32<IS_LITTLE_ENDIAN>(pos, end);
+            case Encoding::UTF_32_LE:
+                return next_utf32<IS_BIG_ENDIAN>(pos, end);
+            default:
+                return {INVALID_CHAR, 0};
+            }
+        }
+
+        Step prev_step(Encoding encoding, const char* begin, const char* pos)
+        {
+            switch (encoding)
+            {
+            case Encoding::UTF_8:
+                return prev_utf8(begin, pos);
+            case Encoding::UTF_16_BE:
+                return prev_utf16<IS_LITTLE_ENDIAN>(begin, pos);
+            case Encoding::UTF_16_LE:
+                return prev_utf16<IS_BIG_ENDIAN>(begin, pos);
+            case Encoding::UTF_32_BE:
+                return prev_utf32<IS_LITTLE_ENDIAN>(begin, pos);
+            case Encoding::UTF_32_LE:
+                return prev_utf32<IS_BIG_ENDIAN>(begin, pos);
+            default:
+                return {INVALID_CHAR, 0};
+            }
+        }
+    }
+
+    CodepointCursor::CodepointCursor() = default;
+
+    CodepointCursor::CodepointCursor(const void* buffer, size_t size,
+                                     Encoding encoding,
+                                     size_t offset)
+        : buffer_(static_cast<const char*>(buffer)),
+          size_(size),
+          offset_(std::min(offset, size)),
+          encoding_(encoding)
+    {
+        switch (encoding)
+        {
+        case Encoding::UTF_8:
+        case Encoding::UTF_16_BE:
+        case Encoding::UTF_16_LE:
+        case Encoding::UTF_32_BE:
+        case Encoding::UTF_32_LE:
+            break;
+        default:
+            YCONVERT_THROW("CodepointCursor doesn't support "
+                           + std::string(get_info(encoding).name));
+        }
+    }
+
+    Encoding CodepointCursor::encoding() const
+    {
+        return encoding_;
+    }
+
+    size_t CodepointCursor::offset() const
+    {
+        return offset_;
+    }
+
+    void CodepointCursor::set_offset(size_t offset)
+    {
+        offset_ = std::min(offset, size_);
+    }
+
+    bool CodepointCursor::next(char32_t* c)
+    {
+        if (offset_ == size_)
+            return false;
+
+        auto step = next_step(encoding_, buffer_ + offset_, buffer_ + size_);
+        *c = step.value;
+        offset_ += step.size;
+        return true;
+    }
+
+    bool CodepointCursor::prev(char32_t* c)
+    {
+        if (offset_ == 0)
+            return false;
+
+        auto step = prev_step(encoding_, buffer_, buffer_ + offset_);
+        *c = step.value;
+        offset_ -= step.size;
+        return true;
+    }
+}
@@ -0,0 +1,363 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/CodepointIndex.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include "Yconvert/Endian.hpp"
+#include "MakeEncodersAndDecoders.hpp"
+#include "Utf8Algorithms.hpp"
+#include "Utf16Algorithms.hpp"
+#include "YconvertThrow.hpp"
+
+namespace Yconvert
+{
+    namespace
+    {
+        constexpr size_t BLOCK_SIZE = 256;
+
+        constexpr char MAGIC[8] = {'Y', 'C', 'P', 'I', 'N', 'D', 'E', 'X'};
+        constexpr uint32_t FORMAT_VERSION = 1;
+        constexpr size_t HEADER_SIZE = sizeof(MAGIC) + 4 * 4 + 4 * 8;
+
+        /**
+         * @brief Functions that count and skip code points in valid
+         *  UTF-8 or UTF-16 without decoding them.
+         */
+        struct FastCounter
+        {
+            /// Returns the number of bytes and code points in the valid
+            /// prefix of a buffer.
+            std::pair<size_t, size_t> (*count)(const void*, size_t) = nullptr;
+            /// Returns the offset of code point n in a valid buffer.
+            size_t (*skip)(const void*, size_t, size_t) = nullptr;
+
+            explicit operator bool() const
+            {
+                return count != nullptr;
+            }
+        };
+
+        template <bool SWAP_BYTES>
+        std::pair<size_t, size_t> count_utf16(const void* src, size_t size)
+        {
+            auto counts = Detail::count_utf16<SWAP_BYTES>(src, size);
+            return {counts.bytes, counts.code_points};
+        }
+
+        FastCounter get_fast_counter(Encoding encoding)
+        {
+            switch (encoding)
+            {
+            case Encoding::UTF_8:
+                return {[](const void* src, size_t size)
+                        {
+                            auto counts = Detail::count_utf8(src, size);
+                            return std::pair(counts.bytes, counts.code_points);
+                        },
+                        Detail::skip_utf8_code_points};
+            case Encoding::UTF_16_BE:
+                return {count_utf16<IS_LITTLE_ENDIAN>,
+                        Detail::skip_utf16_code_points<IS_LITTLE_ENDIAN>};
+            case Encoding::UTF_16_LE:
+                return {count_utf16<IS_BIG_ENDIAN>,
+                        Detail::skip_utf16_code_points<IS_BIG_ENDIAN>};
+            default:
+                return {};
+            }
+        }
+
+        void append_uint(std::string& str, uint64_t value, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i)
+                str.push_back(char(uint8_t(value >> (8 * i))));
+        }
+
+        uint64_t read_uint(std::string_view& str, size_t size)
+        {
+            uint64_t value = 0;
+            for (size_t i = 0; i < size; ++i)
+                value |= uint64_t(uint8_t(str[i])) << (8 * i);
+            str.remove_prefix(size);
+            return value;
+        }
+    }
+
+    struct CodepointIndex::Data
+    {
+        /**
+         * @brief Moves @a n code points forward from the byte offset
+         *  @a pos.
+         *
+         * @returns The new byte offset and the number of code points that
+         *  were passed, which is less than @a n only at the end of
+         *  the buffer.
+         */
+        std::pair<size_t, size_t> advance(size_t pos, size_t n) const
+        {
+            const auto src = buffer.data();
+            const auto end = buffer.size();
+            size_t passed = 0;
+            char32_t block[BLOCK_SIZE];
+            while (n != 0 && pos != end)
+            {
+                if (counter)
+                {
+                    // The next n code points occupy at least n bytes,
+                    // count them without reading much further than that.
+                    auto window = std::min(end - pos, std::max(n, size_t(64)));
+                    auto [bytes, count] = counter.count(src + pos, window);
+                    if (count >= n)
+                        return {pos + counter.skip(src + pos, bytes, n), passed + n};
+                    pos += bytes;
+                    passed += count;
+                    n -= count;
+                    if (bytes != 0)
+                        continue;
+                }
+
+                // Let the decoder handle invalid and incomplete code points.
+                auto m = counter ? 1 : std::min(n, BLOCK_SIZE);
+                auto [r, w] = decoder->decode(src + pos, end - pos, block, m);
+                if (r == 0)
+                    break;
+                pos += r;
+                passed += w;
+                n -= w;
+            }
+            return {pos, passed};
+        }
+
+        /**
+         * @brief Counts the code points from the byte offset @a pos up to
+         *  the code point that contains @a target.
+         */
+        size_t count(size_t pos, size_t target) const
+        {
+            const auto src = buffer.data();
+            const auto end = buffer.size();
+            size_t result = 0;
+            char32_t block[BLOCK_SIZE];
+            while (pos < target)
+            {
+                if (counter)
+                {
+                    auto [bytes, n] = counter.count(src + pos, target - pos);
+                    pos += bytes;
+                    result += n;
+                }
+                else
+                {
+                    auto [r, w] = decoder->decode(src + pos, target - pos,
+                                                  block, BLOCK_SIZE, false);
+                    pos += r;
+                    result += w;
+                }
+
+                if (pos >= target)
+                    break;
+
+                auto [r, w] = decoder->decode(src + pos, end - pos, block, 1);
+                if (r == 0 || pos + r > target)
+                    break;
+                pos += r;
+                result += w;
+            }
+            return result;
+        }
+
+        std::span<const char> buffer;
+        Encoding encoding = Encoding::UNKNOWN;
+        ErrorPolicy error_policy = ErrorPolicy::REPLACE;
+        size_t interval = 1;
+        size_t size = 0;
+        /// The byte offset of every interval'th code point.
+        std::vector<size_t> offsets;
+        std::unique_ptr<Decoder> decoder;
+        FastCounter counter;
+    };
+
+    CodepointIndex::CodepointIndex() = default;
+
+    CodepointIndex::CodepointIndex(const void* buffer, size_t size,
+                                   Encoding encoding,
+                                   size_t interval,
+                                   ErrorPolicy error_policy)
+        : data_(std::make_unique<Data>())
+    {
+        data_->buffer = {static_cast<const char*>(buffer), size};
+        data_->encoding = encoding;
+        data_->error_policy = error_policy;
+        data_->interval = std::max(interval, size_t(1));
+        data_->decoder = make_decoder(encoding);
+        data_->decoder->set_error_policy(error_policy);
+        data_->counter = get_fast_counter(encoding);
+
+        size_t pos = 0;
+        data_->offsets.push_back(0);
+        while (true)
+        {
+            auto [next, n] = data_->advance(pos, data_->interval);
+            data_->size += n;
+            pos = next;
+            if (n != data_->interval || pos == size)
+                break;
+            data_->offsets.push_back(pos);
+        }
+    }
+
+    CodepointIndex::CodepointIndex(CodepointIndex&&) noexcept = default;
+
+    CodepointIndex::~CodepointIndex() = default;
+
+    CodepointIndex& CodepointIndex::operator=(CodepointIndex&&) noexcept = default;
+
+    Encoding CodepointIndex::encoding() const
+    {
+        return data_ ? data_->encoding : Encoding::UNKNOWN;
+    }
+
+    ErrorPolicy CodepointIndex::error_policy() const
+    {
+        return data_ ? data_->error_policy : ErrorPolicy::REPLACE;
+    }
+
+    size_t CodepointIndex::interval() const
+    {
+        return data_ ? data_->interval : DEFAULT_INTERVAL;
+    }
+
+    size_t CodepointIndex::size() const
+    {
+        return data_ ? data_->size : 0;
+    }
+
+    size_t CodepointIndex::byte_offset(size_t codepoint_index) const
+    {
+        if (!data_)
+            return 0;
+        if (codepoint_index >= data_->size)
+            return data_->buffer.size();
+
+        auto checkpoint = codepoint_index / data_->interval;
+        auto pos = data_->offsets[checkpoint];
+        return data_->advance(pos, codepoint_index % data_->interval).first;
+    }
+
+    size_t CodepointIndex::codepoint_index(size_t byte_offset) const
+    {
+        if (!data_)
+            return 0;
+        if (byte_offset >= data_->buffer.size())
+            return data_->size;
+
+        auto it = std::upper_bound(data_->offsets.begin(), data_->offsets.end(),
+                                   byte_offset);
+        auto checkpoint = size_t(it - data_->offsets.begin()) - 1;
+        return checkpoint * data_->interval
+               + data_->count(data_->offsets[checkpoint], byte_offset);
+    }
+
+    CodepointIterator CodepointIndex::seek(size_t codepoint_index) const
+    {
+        if (!data_)
+            return {};
+
+        auto offset = byte_offset(codepoint_index);
+        return {data_->buffer.data() + offset, data_->buffer.size() - offset,
+                data_->encoding, data_->error_policy};
+    }
+
+    std::string CodepointIndex::serialize() const
+    {
+        if (!data_)
+            return {};
+
+        std::string result(MAGIC, sizeof(MAGIC));
+        result.reserve(HEADER_SIZE + data_->offsets.size() * 8);
+        append_uint(result, FORMAT_VERSION, 4);
+        append_uint(result, uint32_t(data_->encoding), 4);
+        append_uint(result, uint32_t(data_->error_policy), 4);
+        append_uint(result, 0, 4);
+        append_uint(result, data_->interval, 8);
+        append_uint(result, data_->buffer.size(), 8);
+        append_uint(result, data_->size, 8);
+        append_uint(result, data_->offsets.size(), 8);
+        for (auto offset : data_->offsets)
+            append_uint(result, offset, 8);
+        return result;
+    }
+
+    CodepointIndex CodepointIndex::deserialize(std::string_view data,
+                                               const void* buffer,
+                                               size_t size)
+    {
+        if (data.size() < HEADER_SIZE
+            || memcmp(data.data(), MAGIC, sizeof(MAGIC)) != 0)
+        {
+            YCONVERT_THROW("Data is not a serialized CodepointIndex.");
+        }
+
+        data.remove_prefix(sizeof(MAGIC));
+        if (read_uint(data, 4) != FORMAT_VERSION)
+            YCONVERT_THROW("Unsupported CodepointIndex format version.");
+
+        auto index_data = std::make_unique<Data>();
+        index_data->encoding = Encoding(read_uint(data, 4));
+        index_data->error_policy = ErrorPolicy(read_uint(data, 4));
+        read_uint(data, 4);
+        index_data->interval = size_t(read_uint(data, 8));
+        auto buffer_size = read_uint(data, 8);
+        index_data->size = size_t(read_uint(data, 8));
+        auto checkpoints = read_uint(data, 8);
+        if (buffer_size != size)
+            YCONVERT_THROW("The CodepointIndex was created for a different buffer.");
+        if (index_data->interval == 0 || index_data->size > size
+            || checkpoints == 0
+            || checkpoints != data.size() / 8 || data.size() % 8 != 0)
+        {
+            YCONVERT_THROW("Serialized CodepointIndex is corrupt.");
+        }
+
+        // There is a checkpoint at the start of every interval, except
+        // that a final interval that ends at the end of the buffer has
+        // none. If the buffer ends with bytes that are ignored, it has
+        // one anyway.
+        auto expected = index_data->size == 0
+                        ? 1 : (index_data->size - 1) / index_data->interval + 1;
+        if (checkpoints != expected
+            && (checkpoints != expected + 1
+                || index_data->size % index_data->interval != 0))
+        {
+            YCONVERT_THROW("Serialized CodepointIndex is corrupt.");
+        }
+
+        index_data->buffer = {static_cast<const char*>(buffer), size};
+        index_data->offsets.reserve(checkpoints);
+        for (uint64_t i = 0; i < checkpoints; ++i)
+        {
+            auto offset = read_uint(data, 8);
+            // The first offset is 0, the others increase and are inside
+            // the buffer.
+            if (i == 0 ? offset != 0
+                       : offset <= index_data->offsets.back() || offset >= size)
+            {
+                YCONVERT_THROW("Serialized CodepointIndex is corrupt.");
+            }
+            index_data->offsets.push_back(size_t(offset));
+        }
+        index_data->decoder = make_decoder(index_data->encoding);
+        index_data->decoder->set_error_policy(index_data->error_policy);
+        index_data->counter = get_fast_counter(index_data->encoding);
+
+        CodepointIndex result;
+        result.data_ = std::move(index_data);
+        return result;
+    }
+}
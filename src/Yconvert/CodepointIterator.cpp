@@ -6,21 +6,24 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include "Yconvert/CodepointIterator.hpp"
+#include <algorithm>
+#include <cstdint>
 #include <istream>
 #include <variant>
+#include <vector>
 #include "Yconvert/Details/InputStreamWrapper.hpp"
+#include "Yconvert/MappedFile.hpp"
 #include "MakeEncodersAndDecoders.hpp"
+#include "Utf32Algorithms.hpp"
 
 namespace Yconvert
 {
     namespace
     {
-        constexpr size_t CHAR32_BUFFER_SIZE = 256;
-
         struct StreamReader
         {
-            explicit StreamReader(std::istream& stream)
-                : input_(stream)
+            StreamReader(std::istream& stream, size_t buffer_size)
+                : input_(stream, buffer_size)
             {}
 
             size_t read(char32_t* buffer, size_t size, const Decoder& decoder)
@@ -49,22 +52,77 @@ namespace Yconvert
             Details::InputStreamWrapper input_;
         };
 
+        bool is_direct_readable(const void* buffer, Encoding encoding)
+        {
+            return encoding == Encoding::UTF_32_NATIVE
+                   && reinterpret_cast<uintptr_t>(buffer) % alignof(char32_t) == 0;
+        }
+
+        /**
+         * @brief Reads code points directly from an aligned buffer in
+         *  native-endian UTF-32.
+         *
+         * Runs of valid code points are returned without being copied.
+         * Invalid values and incomplete code points are passed to the
+         * decoder one at a time, so the result is the same as if the
+         * buffer had been decoded, whatever the error policy.
+         */
+        std::u32string_view read_directly(std::span<const char>& input,
+                                          char32_t* buffer,
+                                          const Decoder& decoder)
+        {
+            auto words = reinterpret_cast<const char32_t*>(input.data());
+            auto count = Detail::find_utf32_value(
+                words, input.size() / sizeof(char32_t), INVALID_CHAR);
+
+            if (count != 0)
+            {
+                input = input.subspan(count * sizeof(char32_t));
+                return {words, count};
+            }
+
+            auto [read, written] = decoder.decode(input.data(), input.size(),
+                                                  buffer, 1);
+            input = input.subspan(read);
+            return {buffer, written};
+        }
+
+        /**
+         * @brief Decodes code points from the start of @a input into
+         *  @a buffer and removes the bytes that have been read from
+         *  @a input.
+         *
+         * The returned view refers to @a input rather than @a buffer if
+         * the code points can be read directly.
+         */
+        std::u32string_view read_codepoints(std::span<const char>& input,
+                                            std::span<char32_t> buffer,
+                                            const Decoder& decoder)
+        {
+            if (is_direct_readable(input.data(), decoder.encoding()))
+                return read_directly(input, buffer.data(), decoder);
+
+            auto [read, written] = decoder.decode(input.data(), input.size(),
+                                                  buffer.data(), buffer.size());
+            input = input.subspan(read);
+            return {buffer.data(), written};
+        }
+
         struct BufferReader
         {
             explicit BufferReader(std::span<const char> buffer)
                 : input_(buffer)
             {}
 
-            size_t read(char32_t* buffer, size_t size, const Decoder& decoder)
+            std::u32string_view read(std::span<char32_t> buffer,
+                                     const Decoder& decoder)
             {
-                auto [read, written] = decoder.decode(input_.data(), input_.size(),
-                                                      buffer, size);
-                input_ = input_.subspan(read);
-                return written;
+                return read_codepoints(input_, buffer, decoder);
             }
 
             std::span<const char> input_;
         };
+
         using Source = std::variant<StreamReader, BufferReader>;
     }
 
@@ -74,12 +132,31 @@ namespace Yconvert
             : source(BufferReader(buffer))
         {}
 
-        explicit Data(std::istream& stream) // NOLINT(*-pro-type-member-init)
-            : source(StreamReader(stream))
+        Data(std::istream& stream, size_t stream_buffer_size) // NOLINT(*-pro-type-member-init)
+            : source(StreamReader(stream, stream_buffer_size))
         {}
 
+        /**
+         * @brief Returns the buffer to decode the next code points into.
+         *
+         * Only called when all code points in the previous buffer have
+         * been consumed, which makes it safe to reallocate it here.
+         */
+        [[nodiscard]] std::span<char32_t> buffer()
+        {
+            if (buffer_size == CodepointIterator::DEFAULT_BUFFER_SIZE)
+            {
+                custom_buffer = {};
+                return fixed_buffer;
+            }
+            custom_buffer.resize(buffer_size);
+            return custom_buffer;
+        }
+
         Source source;
-        char32_t buffer[CHAR32_BUFFER_SIZE];
+        char32_t fixed_buffer[CodepointIterator::DEFAULT_BUFFER_SIZE];
+        std::vector<char32_t> custom_buffer;
+        size_t buffer_size = CodepointIterator::DEFAULT_BUFFER_SIZE;
         std::unique_ptr<Decoder> decoder;
     };
 
@@ -96,13 +173,20 @@ namespace Yconvert
 
     CodepointIterator::CodepointIterator(std::istream& stream,
                                          Encoding encoding,
-                                         ErrorPolicy error_policy)
-        : data_(std::make_unique<Data>(stream))
+                                         ErrorPolicy error_policy,
+                                         size_t stream_buffer_size)
+        : data_(std::make_unique<Data>(stream, stream_buffer_size))
     {
         data_->decoder = make_decoder(encoding);
         data_->decoder->set_error_policy(error_policy);
     }
 
+    CodepointIterator::CodepointIterator(const MappedFile& file,
+                                         Encoding encoding,
+                                         ErrorPolicy error_policy)
+        : CodepointIterator(file.data(), file.size(), encoding, error_policy)
+    {}
+
     CodepointIterator::CodepointIterator(CodepointIterator&& other) noexcept
         : chars_(other.chars_),
           i_(other.i_),
@@ -127,6 +211,32 @@ namespace Yconvert
         return *this;
     }
 
+    void CodepointIterator::set_buffer_size(size_t size)
+    {
+        if (!data_)
+            return;
+
+        // The buffer is resized when it is next filled, chars_ may still
+        // refer to code points in the current one.
+        data_->buffer_size = std::max(size, size_t(1));
+    }
+
+    size_t CodepointIterator::next_block(std::span<char32_t> buffer)
+    {
+        size_t n = 0;
+        while (n != buffer.size())
+        {
+            if (i_ == chars_.size() && !fill_buffer())
+                break;
+
+            auto count = std::min(chars_.size() - i_, buffer.size() - n);
+            std::copy_n(chars_.data() + i_, count, buffer.data() + n);
+            i_ += count;
+            n += count;
+        }
+        return n;
+    }
+
     bool CodepointIterator::fill_buffer()
     {
         if (!data_)
@@ -134,22 +244,43 @@ namespace Yconvert
 
         struct Visitor
         {
-            size_t operator()(StreamReader& reader) const
+            std::u32string_view operator()(StreamReader& reader) const
             {
-                return reader.read(data.buffer, std::size(data.buffer), *data.decoder);
+                auto buffer = data.buffer();
+                auto size = reader.read(buffer.data(), buffer.size(), *data.decoder);
+                return {buffer.data(), size};
             }
 
-            size_t operator()(BufferReader& reader) const
+            std::u32string_view operator()(BufferReader& reader) const
             {
-                return reader.read(data.buffer, std::size(data.buffer), *data.decoder);
+                return reader.read(data.buffer(), *data.decoder);
             }
 
             CodepointIterator::Data& data;
         };
 
-        auto size = std::visit(Visitor{*data_}, data_->source);
-        chars_ = std::u32string_view(data_->buffer, size);
+        chars_ = std::visit(Visitor{*data_}, data_->source);
         i_ = 0;
-        return size != 0;
+        return !chars_.empty();
+    }
+}
+
+namespace Yconvert::Details
+{
+    DecoderHolder::DecoderHolder(Encoding encoding, ErrorPolicy error_policy)
+        : decoder_(make_decoder(encoding, storage_, sizeof(storage_)))
+    {
+        decoder_->set_error_policy(error_policy);
+    }
+
+    DecoderHolder::~DecoderHolder()
+    {
+        decoder_->~Decoder();
+    }
+
+    std::u32string_view DecoderHolder::read(std::span<const char>& input,
+                                            std::span<char32_t> buffer) const
+    {
+        return read_codepoints(input, buffer, *decoder_);
     }
 }
@@ -0,0 +1,71 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/CodepointView.hpp"
+
+#include "MakeEncodersAndDecoders.hpp"
+
+namespace Yconvert
+{
+    namespace
+    {
+        constexpr size_t BLOCK_SIZE = 256;
+    }
+
+    size_t Details::decode_codepoint(const Decoder& decoder,
+                                     const char* pos, const char* end,
+                                     char32_t& value)
+    {
+        auto [read, written] = decoder.decode(pos, size_t(end - pos), &value, 1);
+        return written == 0 ? 0 : read;
+    }
+
+    CodepointView::CodepointView(const void* buffer, size_t size,
+                                 Encoding encoding,
+                                 ErrorPolicy error_policy)
+        : buffer_(static_cast<const char*>(buffer), size)
+    {
+        auto decoder = make_decoder(encoding);
+        decoder->set_error_policy(error_policy);
+        decoder_ = std::move(decoder);
+    }
+
+    CodepointView::Iterator CodepointView::begin() const
+    {
+        if (!decoder_)
+            return {};
+        return {*decoder_, buffer_};
+    }
+
+    size_t CodepointView::count() const
+    {
+        if (!decoder_)
+            return 0;
+
+        char32_t block[BLOCK_SIZE];
+        size_t result = 0;
+        auto input = buffer_;
+        while (true)
+        {
+            auto [read, written] = decoder_->decode(input.data(), input.size(),
+                                                    block, BLOCK_SIZE);
+            result += written;
+            if (written == 0)
+                break;
+            input = input.subspan(read);
+        }
+        return result;
+    }
+
+    size_t CodepointView::copy_to(std::span<char32_t> buffer) const
+    {
+        if (!decoder_)
+            return 0;
+        return decoder_->decode(buffer_.data(), buffer_.size(),
+                                buffer.data(), buffer.size()).second;
+    }
+}
@@ -7,8 +7,229 @@
 //****************************************************************************
 #include "Yconvert/Convert.hpp"
 
+#include <exception>
+#include <ostream>
+#include <thread>
+#include "Yconvert/ConversionException.hpp"
+#include "Yconvert/DetectedStream.hpp"
+#include "MakeEncodersAndDecoders.hpp"
+#include "SpscRing.hpp"
+#include "YconvertThrow.hpp"
+
+#ifndef _WIN32
+    #include <cerrno>
+    #include <cstdlib>
+    #include <cstring>
+    #include <new>
+    #include <unistd.h>
+    #ifdef __linux__
+        #include <sys/sendfile.h>
+    #endif
+#endif
+
 namespace Yconvert
 {
+    namespace
+    {
+        constexpr size_t PIPELINE_BLOCK_SIZE = 16 * 1024;
+        constexpr size_t PIPELINE_BLOCK_COUNT = 8;
+
+        struct CodepointBlock
+        {
+            std::vector<char32_t> chars;
+            size_t size = 0;
+            size_t codepoint_offset = 0;
+        };
+
+        /**
+         * @brief Returns a converter from the detected @a encoding to
+         *  @a destination_encoding, or nullptr if the source is empty
+         *  and there is nothing to convert.
+         */
+        std::unique_ptr<Converter>
+        make_auto_converter(Encoding encoding, bool is_empty,
+                            Encoding destination_encoding,
+                            ErrorPolicy error_policy)
+        {
+            if (encoding == Encoding::UNKNOWN)
+            {
+                if (is_empty)
+                    return nullptr;
+                YCONVERT_THROW("Unable to detect the encoding of the source.");
+            }
+            auto converter = std::make_unique<Converter>(encoding,
+                                                         destination_encoding);
+            converter->set_error_policy(error_policy);
+            return converter;
+        }
+
+        void read_and_decode(std::istream& source, const Decoder& decoder,
+                             SpscRing<CodepointBlock>& ring,
+                             size_t buffer_size)
+        {
+            Details::InputStreamWrapper input(source, buffer_size);
+            size_t codepoint_offset = 0;
+            while (input.fill())
+            {
+                while (input.size() != 0)
+                {
+                    auto block = ring.acquire_for_writing();
+                    if (!block)
+                        return;
+
+                    try
+                    {
+                        auto [n, m] = decoder.decode(input.data(), input.size(),
+                                                     block->chars.data(),
+                                                     block->chars.size(),
+                                                     input.eof());
+                        input.drain(n);
+                        block->size = m;
+                        block->codepoint_offset = codepoint_offset;
+                        codepoint_offset += m;
+                        if (n == 0)
+                            break;
+                    }
+                    catch (ConversionException& ex)
+                    {
+                        ex.codepoint_offset += codepoint_offset;
+                        throw;
+                    }
+                    ring.commit_write();
+                }
+            }
+        }
+    }
+
+#ifndef _WIN32
+
+    namespace
+    {
+        constexpr size_t FD_BUFFER_ALIGNMENT = 4096;
+        constexpr size_t FD_BUFFER_SIZE = 1024 * 1024;
+
+        class AlignedBuffer
+        {
+        public:
+            explicit AlignedBuffer(size_t size)
+                : data_(static_cast<char*>(
+                      std::aligned_alloc(FD_BUFFER_ALIGNMENT, size))),
+                  size_(size)
+            {
+                if (!data_)
+                    throw std::bad_alloc();
+            }
+
+            AlignedBuffer(const AlignedBuffer&) = delete;
+
+            ~AlignedBuffer()
+            {
+                std::free(data_);
+            }
+
+            AlignedBuffer& operator=(const AlignedBuffer&) = delete;
+
+            [[nodiscard]] char* data() const
+            {
+                return data_;
+            }
+
+            [[nodiscard]] size_t size() const
+            {
+                return size_;
+            }
+        private:
+            char* data_;
+            size_t size_;
+        };
+
+        size_t read_fd(int fd, char* buffer, size_t size)
+        {
+            for (;;)
+            {
+                auto n = ::read(fd, buffer, size);
+                if (n >= 0)
+                    return size_t(n);
+                if (errno != EINTR)
+                {
+                    YCONVERT_THROW("Unable to read from file descriptor: "
+                                   + std::string(std::strerror(errno)));
+                }
+            }
+        }
+
+        void write_fd(int fd, const char* buffer, size_t size)
+        {
+            while (size != 0)
+            {
+                auto n = ::write(fd, buffer, size);
+                if (n < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    YCONVERT_THROW("Unable to write to file descriptor: "
+                                   + std::string(std::strerror(errno)));
+                }
+                buffer += n;
+                size -= size_t(n);
+            }
+        }
+
+        /**
+         * @brief Lets the kernel move the bytes from @a source to
+         *  @a destination without copying them through user space.
+         *
+         * @return false if neither copy_file_range nor sendfile can be used
+         *  with these file descriptors. Any bytes that have been transferred
+         *  before that is discovered are not transferred again, the file
+         *  positions are updated as the transfer progresses.
+         */
+        bool kernel_copy([[maybe_unused]] int source,
+                         [[maybe_unused]] int destination)
+        {
+        #ifdef __linux__
+            for (;;)
+            {
+                auto n = ::copy_file_range(source, nullptr,
+                                           destination, nullptr,
+                                           FD_BUFFER_SIZE, 0);
+                if (n > 0)
+                    continue;
+                if (n == 0)
+                    return true;
+                if (errno == EINTR)
+                    continue;
+                if (errno == EXDEV || errno == EINVAL || errno == ENOSYS
+                    || errno == EBADF || errno == EOPNOTSUPP)
+                {
+                    break;
+                }
+                YCONVERT_THROW("copy_file_range failed: "
+                               + std::string(std::strerror(errno)));
+            }
+
+            for (;;)
+            {
+                auto n = ::sendfile(destination, source, nullptr,
+                                    FD_BUFFER_SIZE);
+                if (n > 0)
+                    continue;
+                if (n == 0)
+                    return true;
+                if (errno == EINTR)
+                    continue;
+                if (errno == EINVAL || errno == ENOSYS)
+                    break;
+                YCONVERT_THROW("sendfile failed: "
+                               + std::string(std::strerror(errno)));
+            }
+        #endif
+            return false;
+        }
+    }
+
+#endif
+
     std::pair<size_t, size_t>
     convert(const void* source, size_t source_size,
             void* destination, size_t destination_size,
@@ -40,9 +261,10 @@ namespace Yconvert
 
     void convert(std::istream& source,
                  std::string& destination,
-                 Converter& converter)
+                 Converter& converter,
+                 size_t buffer_size)
     {
-        Details::InputStreamWrapper input(source);
+        Details::InputStreamWrapper input(source, buffer_size);
         while (input.fill())
         {
             auto src_siz = converter.convert(input.data(), input.size(),
@@ -53,9 +275,10 @@ namespace Yconvert
 
     void convert(std::istream& source,
                  std::ostream& destination,
-                 Converter& converter)
+                 Converter& converter,
+                 size_t buffer_size)
     {
-        Details::InputStreamWrapper input(source);
+        Details::InputStreamWrapper input(source, buffer_size);
         while (input.fill())
         {
             auto src_siz = converter.convert(input.data(), input.size(),
@@ -66,10 +289,203 @@ namespace Yconvert
 
     void convert(std::istream& source, Encoding source_encoding,
                  std::ostream& destination, Encoding destination_encoding,
-                 ErrorPolicy error_policy)
+                 ErrorPolicy error_policy, size_t buffer_size)
+    {
+        Converter converter(source_encoding, destination_encoding);
+        converter.set_error_policy(error_policy);
+        convert(source, destination, converter, buffer_size);
+    }
+
+    Encoding convert_auto(const void* source, size_t source_size,
+                          std::string& destination,
+                          Encoding destination_encoding,
+                          ErrorPolicy error_policy)
+    {
+        EncodingDetector detector;
+        detector.add(source, source_size);
+        detector.finish();
+        auto encoding = detector.encoding();
+        auto converter = make_auto_converter(encoding, source_size == 0,
+                                             destination_encoding,
+                                             error_policy);
+        if (converter)
+        {
+            auto bom_size = detector.byte_order_mark_size();
+            converter->convert(static_cast<const char*>(source) + bom_size,
+                               source_size - bom_size, destination);
+        }
+        return encoding;
+    }
+
+    Encoding convert_auto(std::istream& source,
+                          std::string& destination,
+                          Encoding destination_encoding,
+                          ErrorPolicy error_policy)
+    {
+        DetectedStream stream(source);
+        auto encoding = stream.encoding();
+        auto is_empty = stream.peek() == std::istream::traits_type::eof();
+        auto converter = make_auto_converter(encoding, is_empty,
+                                             destination_encoding,
+                                             error_policy);
+        if (converter)
+            convert(stream, destination, *converter);
+        return encoding;
+    }
+
+    Encoding convert_auto(std::istream& source,
+                          std::ostream& destination,
+                          Encoding destination_encoding,
+                          ErrorPolicy error_policy)
+    {
+        DetectedStream stream(source);
+        auto encoding = stream.encoding();
+        auto is_empty = stream.peek() == std::istream::traits_type::eof();
+        auto converter = make_auto_converter(encoding, is_empty,
+                                             destination_encoding,
+                                             error_policy);
+        if (converter)
+            convert(stream, destination, *converter);
+        return encoding;
+    }
+
+    void convert_pipelined(std::istream& source,
+                           std::ostream& destination,
+                           Converter& converter,
+                           size_t buffer_size)
+    {
+        // The offset map is extended by the converter, which the reader
+        // and writer threads bypass.
+        if (converter.is_copy() || converter.offset_map())
+        {
+            convert(source, destination, converter, buffer_size);
+            return;
+        }
+
+        auto decoder = make_decoder(converter.source_encoding());
+        decoder->set_error_policy(converter.error_policy());
+        auto encoder = make_encoder(converter.destination_encoding());
+        encoder->set_error_policy(converter.error_policy());
+        encoder->set_replacement_character(converter.replacement_character());
+
+        SpscRing<CodepointBlock> ring(
+            PIPELINE_BLOCK_COUNT,
+            CodepointBlock{std::vector<char32_t>(PIPELINE_BLOCK_SIZE)});
+
+        std::exception_ptr reader_exception;
+        std::thread reader([&]
+        {
+            try
+            {
+                read_and_decode(source, *decoder, ring, buffer_size);
+            }
+            catch (...)
+            {
+                reader_exception = std::current_exception();
+            }
+            ring.close_for_writing();
+        });
+
+        try
+        {
+            std::vector<char> output(PIPELINE_BLOCK_SIZE * 4);
+            while (auto block = ring.acquire_for_reading())
+            {
+                size_t i = 0;
+                while (i != block->size)
+                {
+                    try
+                    {
+                        auto [n, m] = encoder->encode(block->chars.data() + i,
+                                                      block->size - i,
+                                                      output.data(),
+                                                      output.size());
+                        if (n == 0)
+                            YCONVERT_THROW("The output buffer is too small.");
+                        destination.write(output.data(), std::streamsize(m));
+                        i += n;
+                    }
+                    catch (ConversionException& ex)
+                    {
+                        ex.codepoint_offset += block->codepoint_offset + i;
+                        throw;
+                    }
+                }
+                ring.commit_read();
+            }
+        }
+        catch (...)
+        {
+            ring.close_for_reading();
+            reader.join();
+            throw;
+        }
+
+        reader.join();
+        if (reader_exception)
+            std::rethrow_exception(reader_exception);
+    }
+
+    void convert_pipelined(std::istream& source, Encoding source_encoding,
+                           std::ostream& destination, Encoding destination_encoding,
+                           ErrorPolicy error_policy, size_t buffer_size)
     {
         Converter converter(source_encoding, destination_encoding);
         converter.set_error_policy(error_policy);
-        convert(source, destination, converter);
+        convert_pipelined(source, destination, converter, buffer_size);
     }
+
+#ifndef _WIN32
+
+    void convert_fd(int source, int destination, Converter& converter)
+    {
+        if (converter.is_copy()
+            && converter.source_encoding() == converter.destination_encoding()
+            && kernel_copy(source, destination))
+        {
+            return;
+        }
+
+        AlignedBuffer input(FD_BUFFER_SIZE);
+        AlignedBuffer output(FD_BUFFER_SIZE);
+        size_t input_size = 0;
+        bool eof = false;
+        while (!eof)
+        {
+            auto n = read_fd(source, input.data() + input_size,
+                             input.size() - input_size);
+            eof = n == 0;
+            input_size += n;
+
+            size_t offset = 0;
+            while (offset != input_size)
+            {
+                auto [m, k] = converter.convert(input.data() + offset,
+                                                input_size - offset,
+                                                output.data(), output.size(),
+                                                eof);
+                write_fd(destination, output.data(), k);
+                if (m == 0)
+                    break;
+                offset += m;
+            }
+
+            // Move the incomplete character at the end of the buffer, if
+            // any, to the front.
+            input_size -= offset;
+            if (input_size != 0 && offset != 0)
+                memmove(input.data(), input.data() + offset, input_size);
+        }
+    }
+
+    void convert_fd(int source, Encoding source_encoding,
+                    int destination, Encoding destination_encoding,
+                    ErrorPolicy error_policy)
+    {
+        Converter converter(source_encoding, destination_encoding);
+        converter.set_error_policy(error_policy);
+        convert_fd(source, destination, converter);
+    }
+
+#endif
 }
@@ -12,12 +12,27 @@
 #include <ostream>
 #include <vector>
 #include "Yconvert/ConversionException.hpp"
+#include "Yconvert/MappedFile.hpp"
+#include "Yconvert/OffsetMap.hpp"
 #include "MakeEncodersAndDecoders.hpp"
+#include "Utf16Algorithms.hpp"
+#include "Utf8Algorithms.hpp"
+#include "YconvertThrow.hpp"
 
 namespace Yconvert
 {
     namespace
     {
+        /**
+         * @brief The number of bytes given to the regular decoder and
+         *  encoder when a transcoder stops at an invalid or incomplete
+         *  code point.
+         *
+         * It must be large enough to contain any invalid code point and
+         * the code unit that follows it.
+         */
+        constexpr size_t TRANSCODER_FALLBACK_SIZE = 8;
+
         size_t find_nth_code_point(Decoder& decoder,
                                    const char* src, size_t src_size,
                                    std::vector<char32_t>& buf, size_t n)
@@ -31,6 +46,50 @@ namespace Yconvert
             return decoder.decode(src, src_size, buf.data(), n).first;
         }
 
+        /**
+         * @brief Returns the number of bytes @a encoding uses for @a c,
+         *  or 0 if it can't be encoded.
+         *
+         * Single-unit encodings are assumed to be able to encode every
+         * code point, either directly or with a replacement character.
+         */
+        uint32_t get_encoded_width(Encoding encoding, char32_t c)
+        {
+            switch (encoding)
+            {
+            case Encoding::UTF_8:
+                if (c < 0x80)
+                    return 1;
+                if (c < 0x800)
+                    return 2;
+                if (c < 0x10000)
+                    return 3;
+                return c <= UNICODE_MAX ? 4 : 0;
+            case Encoding::UTF_16_LE:
+            case Encoding::UTF_16_BE:
+                if (c < 0x10000)
+                    return 2;
+                return c <= UNICODE_MAX ? 4 : 0;
+            case Encoding::UTF_32_LE:
+            case Encoding::UTF_32_BE:
+                return c <= UNICODE_MAX ? 4 : 0;
+            default:
+                return uint32_t(get_info(encoding).unit_size);
+            }
+        }
+
+        /**
+         * @brief Returns the number of bytes in the valid UTF-8 sequence
+         *  at the start of @a src.
+         */
+        uint32_t get_utf8_sequence_length(const char* src, size_t src_size)
+        {
+            uint32_t n = 1;
+            while (n < src_size && (uint8_t(src[n]) & 0xC0u) == 0x80u)
+                ++n;
+            return n;
+        }
+
         template <unsigned UNIT_SIZE>
         size_t endian_copy(const void* src, size_t srcSize,
                            void* dst, size_t dstSize)
@@ -59,8 +118,12 @@ namespace Yconvert
     Converter::Converter(Encoding src_encoding, Encoding dst_encoding)
         : decoder_(make_decoder(src_encoding)),
           encoder_(make_encoder(dst_encoding)),
-          conversion_type_(get_conversion_type(src_encoding, dst_encoding))
-    {}
+          conversion_type_(get_conversion_type(src_encoding, dst_encoding)),
+          transcoder_(get_transcoder(src_encoding, dst_encoding))
+    {
+        if (transcoder_)
+            conversion_type_ = ConversionType::TRANSCODE;
+    }
 
     Converter::Converter(Converter&&) noexcept = default;
 
@@ -99,6 +162,16 @@ namespace Yconvert
         encoder_->set_replacement_character(value);
     }
 
+    OffsetMap* Converter::offset_map() const
+    {
+        return offset_map_;
+    }
+
+    void Converter::set_offset_map(OffsetMap* map)
+    {
+        offset_map_ = map;
+    }
+
     Encoding Converter::source_encoding() const
     {
         return decoder_->encoding();
@@ -109,10 +182,20 @@ namespace Yconvert
         return encoder_->encoding();
     }
 
+    bool Converter::is_copy() const
+    {
+        auto type = effective_conversion_type();
+        return type == ConversionType::COPY
+               || type == ConversionType::SWAP_ENDIANNESS;
+    }
+
     size_t Converter::get_encoded_size(const void* src, size_t src_size)
     {
-        if (conversion_type_ != ConversionType::CONVERT)
+        if (conversion_type_ == ConversionType::COPY
+            || conversion_type_ == ConversionType::SWAP_ENDIANNESS)
+        {
             return src_size;
+        }
 
         if (buffer_.empty())
             buffer_.resize(BUFFER_SIZE);
@@ -124,6 +207,17 @@ namespace Yconvert
         auto bytes = static_cast<const char*>(src);
         size_t size = 0;
         size_t offset = 0;
+        if (dec.encoding == Encoding::UTF_8 && enc.unit_size != 1)
+        {
+            // Compute the size of the valid UTF-8 prefix directly from
+            // the source bytes, only the rest needs to be decoded.
+            auto counts = Detail::count_utf8(src, src_size);
+            offset = counts.bytes;
+            size = enc.unit_size == 2
+                   ? counts.utf16_units() * 2
+                   : counts.utf32_units() * 4;
+        }
+
         for (;;)
         {
             auto [n, m] = decoder_->decode(bytes + offset, src_size - offset,
@@ -140,10 +234,7 @@ namespace Yconvert
                               std::string& dst,
                               bool src_is_final)
     {
-        auto conversion_type = error_policy() == ErrorPolicy::IGNORE
-            ? conversion_type_
-            : ConversionType::CONVERT;
-        switch (conversion_type)
+        switch (effective_conversion_type())
         {
         case ConversionType::SWAP_ENDIANNESS:
             {
@@ -158,6 +249,8 @@ namespace Yconvert
                 dst.resize(old_size + src_size);
                 return copy(src, src_size, dst.data() + old_size, src_size);
             }
+        case ConversionType::TRANSCODE:
+            return transcode(src, src_size, dst, src_is_final);
         case ConversionType::CONVERT:
             return do_convert(src, src_size, dst, src_is_final);
         default:
@@ -170,10 +263,7 @@ namespace Yconvert
                        void* dst, size_t dst_size,
                        bool src_is_final)
     {
-        auto conversion_type = error_policy() == ErrorPolicy::IGNORE
-                               ? conversion_type_
-                               : ConversionType::CONVERT;
-        switch (conversion_type)
+        switch (effective_conversion_type())
         {
         case ConversionType::SWAP_ENDIANNESS:
         {
@@ -185,6 +275,8 @@ namespace Yconvert
             auto n = copy(src, src_size, dst, dst_size);
             return {n, n};
         }
+        case ConversionType::TRANSCODE:
+            return transcode(src, src_size, dst, dst_size, src_is_final);
         case ConversionType::CONVERT:
             return do_convert(src, src_size, dst, dst_size, src_is_final);
         default:
@@ -196,10 +288,7 @@ namespace Yconvert
                               std::ostream& dst,
                               bool src_is_final)
     {
-        auto conversion_type = error_policy() == ErrorPolicy::IGNORE
-                               ? conversion_type_
-                               : ConversionType::CONVERT;
-        switch (conversion_type)
+        switch (effective_conversion_type())
         {
         case ConversionType::SWAP_ENDIANNESS:
         {
@@ -213,6 +302,8 @@ namespace Yconvert
             dst.write(static_cast<const char*>(src), count);
             return count;
         }
+        case ConversionType::TRANSCODE:
+            return transcode(src, src_size, dst, src_is_final);
         case ConversionType::CONVERT:
             return do_convert(src, src_size, dst, src_is_final);
         default:
@@ -220,6 +311,64 @@ namespace Yconvert
         }
     }
 
+    size_t Converter::convert(const MappedFile& src, std::string& dst)
+    {
+        return convert(src.data(), src.size(), dst, true);
+    }
+
+    size_t Converter::convert(const MappedFile& src, std::ostream& dst)
+    {
+        return convert(src.data(), src.size(), dst, true);
+    }
+
+    std::pair<size_t, size_t>
+    Converter::reconvert(const void* src, size_t src_size,
+                         size_t offset, size_t old_size, size_t new_size,
+                         std::string& dst)
+    {
+        if (!offset_map_)
+            YCONVERT_THROW("reconvert requires an offset map.");
+
+        auto& map = *offset_map_;
+        if (offset > map.source_size()
+            || old_size > map.source_size() - offset
+            || src_size != map.source_size() - old_size + new_size
+            || dst.size() != map.destination_size())
+        {
+            YCONVERT_THROW("The edit doesn't match the offset map.");
+        }
+
+        // Include one more code point on either side, an invalid or
+        // incomplete sequence next to the edit may combine with the new
+        // bytes.
+        auto src_begin = map.floor_source_offset(offset);
+        auto src_end = map.ceil_source_offset(offset + old_size);
+        if (src_begin != 0)
+            src_begin = map.floor_source_offset(src_begin - 1);
+        src_end = map.ceil_source_offset(src_end + 1);
+        auto dst_begin = map.to_destination(src_begin);
+        auto dst_end = map.to_destination(src_end);
+
+        OffsetMap edit_map;
+        std::string edit_dst;
+        offset_map_ = &edit_map;
+        try
+        {
+            auto size = src_end - src_begin - old_size + new_size;
+            convert(static_cast<const char*>(src) + src_begin, size, edit_dst);
+        }
+        catch (...)
+        {
+            offset_map_ = &map;
+            throw;
+        }
+        offset_map_ = &map;
+
+        dst.replace(dst_begin, dst_end - dst_begin, edit_dst);
+        map.replace(src_begin, src_end - src_begin, edit_map);
+        return {dst_begin, edit_dst.size()};
+    }
+
     Converter::ConversionType Converter::get_conversion_type(
             Encoding src, Encoding dst)
     {
@@ -235,6 +384,60 @@ namespace Yconvert
         return ConversionType::CONVERT;
     }
 
+    Converter::Transcoder Converter::get_transcoder(Encoding src, Encoding dst)
+    {
+        using namespace Detail;
+        constexpr auto LE = IS_BIG_ENDIAN;
+        constexpr auto BE = IS_LITTLE_ENDIAN;
+        switch (src)
+        {
+        case Encoding::UTF_16_LE:
+            if (dst == Encoding::UTF_32_LE)
+                return transcode_utf16_to_utf32<LE, LE>;
+            if (dst == Encoding::UTF_32_BE)
+                return transcode_utf16_to_utf32<LE, BE>;
+            break;
+        case Encoding::UTF_16_BE:
+            if (dst == Encoding::UTF_32_LE)
+                return transcode_utf16_to_utf32<BE, LE>;
+            if (dst == Encoding::UTF_32_BE)
+                return transcode_utf16_to_utf32<BE, BE>;
+            break;
+        case Encoding::UTF_32_LE:
+            if (dst == Encoding::UTF_16_LE)
+                return transcode_utf32_to_utf16<LE, LE>;
+            if (dst == Encoding::UTF_16_BE)
+                return transcode_utf32_to_utf16<LE, BE>;
+            break;
+        case Encoding::UTF_32_BE:
+            if (dst == Encoding::UTF_16_LE)
+                return transcode_utf32_to_utf16<BE, LE>;
+            if (dst == Encoding::UTF_16_BE)
+                return transcode_utf32_to_utf16<BE, BE>;
+            break;
+        default:
+            break;
+        }
+        return nullptr;
+    }
+
+    Converter::ConversionType Converter::effective_conversion_type() const
+    {
+        // The offsets are recorded from the decoded code points.
+        if (offset_map_)
+            return ConversionType::CONVERT;
+
+        // Copying and swapping bytes don't check that the input is valid
+        // and are therefore only used when errors are ignored.
+        if (error_policy() != ErrorPolicy::IGNORE
+            && (conversion_type_ == ConversionType::COPY
+                || conversion_type_ == ConversionType::SWAP_ENDIANNESS))
+        {
+            return ConversionType::CONVERT;
+        }
+        return conversion_type_;
+    }
+
     size_t Converter::copy(const void* src, size_t src_size,
                            void* dst, size_t dst_size)
     {
@@ -290,7 +493,13 @@ namespace Yconvert
                                                       src_is_final);
             if (dec_in == 0)
                 break;
+            auto dst_size = dst.size();
             encoder_->encode(buffer_.data(), dec_out, dst);
+            if (offset_map_)
+            {
+                record_offsets(c_src, dec_in, buffer_.data(), dec_out,
+                               dst.size() - dst_size, src_is_final);
+            }
             c_src += dec_in;
             src_size -= dec_in;
         }
@@ -327,10 +536,23 @@ namespace Yconvert
                     // not encoded all codepoints in the input buffer. We need
                     // to rewind the input buffer to the end of the last code
                     // point that was encoded.
-                    src_size -= find_nth_code_point(*decoder_, c_src, src_size,
-                                                    buffer_, enc_in);
+                    auto n = find_nth_code_point(*decoder_, c_src, src_size,
+                                                 buffer_, enc_in);
+                    if (offset_map_)
+                    {
+                        record_offsets(c_src, n, buffer_.data(), enc_in,
+                                       enc_out, src_is_final);
+                    }
+                    src_size -= n;
+                    cdst += enc_out;
+                    dst_size -= enc_out;
                     break;
                 }
+                if (offset_map_)
+                {
+                    record_offsets(c_src, dec_in, buffer_.data(), dec_out,
+                                   enc_out, src_is_final);
+                }
                 c_src += dec_in;
                 src_size -= dec_in;
                 cdst += enc_out;
@@ -363,10 +585,193 @@ namespace Yconvert
                                                       src_is_final);
             if (dec_in == 0)
                 break;
-            encoder_->encode(buffer_.data(), dec_out, dst);
+            if (offset_map_)
+            {
+                std::string encoded;
+                encoder_->encode(buffer_.data(), dec_out, encoded);
+                record_offsets(c_src, dec_in, buffer_.data(), dec_out,
+                               encoded.size(), src_is_final);
+                dst.write(encoded.data(), std::streamsize(encoded.size()));
+            }
+            else
+            {
+                encoder_->encode(buffer_.data(), dec_out, dst);
+            }
             c_src += dec_in;
             src_size -= dec_in;
         }
         return original_size - src_size;
     }
+
+    void Converter::record_offsets(const char* src, size_t src_size,
+                                   const char32_t* code_points, size_t count,
+                                   size_t dst_size,
+                                   bool src_is_final)
+    {
+        const auto src_encoding = decoder_->encoding();
+        const auto dst_encoding = encoder_->encoding();
+
+        // The lengths are computed from the code points and the source
+        // bytes, which is exact as long as there were no errors. Errors
+        // are detected by comparing the sum of the lengths with the
+        // actual sizes.
+        size_t dst_sum = 0;
+        for (size_t i = 0; i < count; ++i)
+            dst_sum += get_encoded_width(dst_encoding, code_points[i]);
+
+        if (dst_sum == dst_size)
+        {
+            auto& map = *offset_map_;
+            const auto& src_info = get_info(src_encoding);
+            if (src_encoding == Encoding::UTF_8)
+            {
+                // Overlong sequences are accepted by the decoder, the
+                // lengths must therefore be found in the source.
+                auto counts = Detail::count_utf8(src, src_size);
+                if (counts.bytes == src_size && counts.code_points == count)
+                {
+                    size_t offset = 0;
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        auto width = get_utf8_sequence_length(
+                            src + offset, src_size - offset);
+                        map.add(1, width,
+                                get_encoded_width(dst_encoding, code_points[i]));
+                        offset += width;
+                    }
+                    return;
+                }
+            }
+            else if (src_info.max_units != 1)
+            {
+                size_t src_sum = 0;
+                for (size_t i = 0; i < count; ++i)
+                    src_sum += get_encoded_width(src_encoding, code_points[i]);
+                if (src_sum == src_size)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        map.add(1, get_encoded_width(src_encoding, code_points[i]),
+                                get_encoded_width(dst_encoding, code_points[i]));
+                    }
+                    return;
+                }
+            }
+            else if (src_size == count * src_info.unit_size)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    map.add(1, uint32_t(src_info.unit_size),
+                            get_encoded_width(dst_encoding, code_points[i]));
+                }
+                return;
+            }
+        }
+
+        // Decode and encode one code point at a time to get the exact
+        // lengths of invalid sequences, skipped bytes and replacements.
+        char encoded[16];
+        while (src_size != 0)
+        {
+            char32_t c;
+            auto [n, m] = decoder_->decode(src, src_size, &c, 1, src_is_final);
+            if (n == 0)
+                break;
+            size_t width = 0;
+            if (m != 0)
+                width = encoder_->encode(&c, 1, encoded, sizeof(encoded)).second;
+            offset_map_->add(1, uint32_t(n), uint32_t(width));
+            src += n;
+            src_size -= n;
+        }
+    }
+
+    std::pair<size_t, size_t>
+    Converter::transcode(const void* src, size_t src_size,
+                         void* dst, size_t dst_size,
+                         bool src_is_final)
+    {
+        const auto src_unit_size = get_info(decoder_->encoding()).unit_size;
+        auto c_src = static_cast<const char*>(src);
+        auto cdst = static_cast<char*>(dst);
+        size_t src_offset = 0;
+        size_t dst_offset = 0;
+        size_t code_point_offset = 0;
+        auto count_code_points = [&](size_t n, size_t m)
+        {
+            // The UTF-32 side has one code unit per code point.
+            return src_unit_size == 4 ? n / 4 : m / 4;
+        };
+
+        while (true)
+        {
+            auto [n, m] = transcoder_(c_src + src_offset, src_size - src_offset,
+                                      cdst + dst_offset, dst_size - dst_offset);
+            src_offset += n;
+            dst_offset += m;
+            code_point_offset += count_code_points(n, m);
+            if (src_offset == src_size)
+                break;
+
+            // The transcoder stopped at an invalid or incomplete code point,
+            // or because the output buffer is full. Let the decoder and
+            // encoder handle the next few bytes according to the error
+            // policy.
+            auto size = std::min(src_size - src_offset, TRANSCODER_FALLBACK_SIZE);
+            try
+            {
+                auto [n2, m2] = do_convert(c_src + src_offset, size,
+                                           cdst + dst_offset, dst_size - dst_offset,
+                                           src_is_final && size == src_size - src_offset);
+                if (n2 == 0)
+                    break;
+                src_offset += n2;
+                dst_offset += m2;
+                code_point_offset += count_code_points(n2, m2);
+            }
+            catch (ConversionException& ex)
+            {
+                ex.codepoint_offset += code_point_offset;
+                throw;
+            }
+        }
+        return {src_offset, dst_offset};
+    }
+
+    size_t Converter::transcode(const void* src, size_t src_size,
+                                std::string& dst,
+                                bool src_is_final)
+    {
+        // UTF-16 to UTF-32 at most doubles the size, the additional bytes
+        // leave room for replacement characters for incomplete input.
+        auto old_size = dst.size();
+        dst.resize(old_size + 2 * src_size + 8);
+        auto [n, m] = transcode(src, src_size, dst.data() + old_size,
+                                dst.size() - old_size, src_is_final);
+        dst.resize(old_size + m);
+        return n;
+    }
+
+    size_t Converter::transcode(const void* src, size_t src_size,
+                                std::ostream& dst,
+                                bool src_is_final)
+    {
+        if (buffer_.empty())
+            buffer_.resize(BUFFER_SIZE);
+
+        auto buf = reinterpret_cast<char*>(buffer_.data());
+        auto buf_size = buffer_.size() * sizeof(char32_t);
+        auto c_src = static_cast<const char*>(src);
+        size_t offset = 0;
+        while (offset != src_size)
+        {
+            auto [n, m] = transcode(c_src + offset, src_size - offset,
+                                    buf, buf_size, src_is_final);
+            if (n == 0)
+                break;
+            dst.write(buf, std::streamsize(m));
+            offset += n;
+        }
+        return offset;
+    }
 }
@@ -64,7 +64,7 @@ namespace Yconvert
                 throw ConversionException("Invalid character in input.", i_dst);
             case ErrorPolicy::SKIP:
             case ErrorPolicy::IGNORE:
-                i_src += skip_codepoint(bytes, src_size);
+                i_src += skip_codepoint(bytes + i_src, src_size - i_src);
                 break;
             }
         }
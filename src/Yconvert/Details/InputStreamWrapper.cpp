@@ -7,26 +7,54 @@
 //****************************************************************************
 #include "Yconvert/Details/InputStreamWrapper.hpp"
 #include "Yconvert/YconvertThrow.hpp"
+#include <algorithm>
+#include <cstring>
 #include <istream>
 
 namespace Yconvert::Details
 {
-    InputStreamWrapper::InputStreamWrapper(std::istream& stream) // NOLINT(*-pro-type-member-init)
-        : stream_(&stream)
+    namespace
+    {
+        /**
+         * @brief The maximum number of undrained bytes that are carried
+         *  over to the next chunk without compacting the buffer.
+         */
+        constexpr size_t CARRY_SIZE = 64;
+    }
+
+    InputStreamWrapper::InputStreamWrapper(std::istream& stream,
+                                           size_t capacity)
+        : stream_(&stream),
+          buffer_(CARRY_SIZE + std::clamp(capacity, MIN_CAPACITY, MAX_CAPACITY)),
+          offset_(CARRY_SIZE)
     {}
 
     bool InputStreamWrapper::fill()
     {
-        if (offset_ != 0 && size_ != 0)
+        auto buffer = buffer_.data();
+        if (size_ <= CARRY_SIZE)
         {
-            std::copy(buffer_ + ptrdiff_t(offset_),
-                      buffer_ + ptrdiff_t(offset_ + size_),
-                      buffer_);
+            // Put the remaining bytes immediately in front of the area that
+            // is read from the stream.
+            auto carry_offset = CARRY_SIZE - size_;
+            if (size_ != 0 && offset_ != carry_offset)
+                memmove(buffer + carry_offset, buffer + offset_, size_);
+            offset_ = carry_offset;
+            size_ += read(buffer + CARRY_SIZE, buffer_.size() - CARRY_SIZE);
+        }
+        else
+        {
+            // Most of the previous chunk is still there. Read into the
+            // free space after it, and only compact the buffer if there
+            // isn't any.
+            if (offset_ + size_ == buffer_.size())
+            {
+                memmove(buffer, buffer + offset_, size_);
+                offset_ = 0;
+            }
+            auto end = offset_ + size_;
+            size_ += read(buffer + end, buffer_.size() - end);
         }
-        offset_ = 0;
-        stream_->read(buffer_ + size_,
-                      std::streamsize(sizeof(buffer_) - size_));
-        size_ += stream_->gcount();
         return size_ != 0;
     }
 
@@ -45,7 +73,7 @@ namespace Yconvert::Details
 
     const char* InputStreamWrapper::data() const
     {
-        return buffer_ + offset_;
+        return buffer_.data() + offset_;
     }
 
     size_t InputStreamWrapper::size() const
@@ -53,8 +81,26 @@ namespace Yconvert::Details
         return size_;
     }
 
+    size_t InputStreamWrapper::capacity() const
+    {
+        return buffer_.size() - CARRY_SIZE;
+    }
+
     bool InputStreamWrapper::eof() const
     {
         return stream_->eof();
     }
+
+    size_t InputStreamWrapper::read(char* buffer, size_t size)
+    {
+        auto streambuf = stream_->rdbuf();
+        if (size == 0 || !streambuf || !stream_->good())
+            return 0;
+
+        auto n = streambuf->sgetn(buffer, std::streamsize(size));
+        // Leave the stream in the same state std::istream::read would have.
+        if (size_t(n) < size)
+            stream_->setstate(std::ios::eofbit | std::ios::failbit);
+        return size_t(n);
+    }
 }
@@ -0,0 +1,72 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/DetectedStream.hpp"
+
+#include <algorithm>
+#include "ReplayStreamBuf.hpp"
+
+namespace Yconvert
+{
+    namespace
+    {
+        /**
+         * @brief The number of bytes that are read from the underlying
+         *  stream at a time while the encoding is undecided.
+         */
+        constexpr size_t DETECTION_CHUNK_SIZE = 4096;
+    }
+
+    DetectedStream::DetectedStream(std::istream& stream,
+                                   size_t max_size,
+                                   double threshold)
+        : std::istream(nullptr),
+          detector_(max_size, threshold)
+    {
+        auto source = stream.good() ? stream.rdbuf() : nullptr;
+        std::vector<char> prefix;
+        while (source && !detector_.is_done())
+        {
+            auto offset = prefix.size();
+            prefix.resize(offset + DETECTION_CHUNK_SIZE);
+            auto n = source->sgetn(prefix.data() + offset,
+                                   std::streamsize(DETECTION_CHUNK_SIZE));
+            prefix.resize(offset + size_t(std::max<std::streamsize>(n, 0)));
+            if (n <= 0)
+            {
+                // Leave the stream in the same state std::istream::read
+                // would have.
+                stream.setstate(std::ios::eofbit | std::ios::failbit);
+                source = nullptr;
+                break;
+            }
+            detector_.add(prefix.data() + offset, size_t(n));
+        }
+        detector_.finish();
+
+        buffer_ = std::make_unique<Detail::ReplayStreamBuf>(
+            source, std::move(prefix), detector_.byte_order_mark_size());
+        rdbuf(buffer_.get());
+    }
+
+    DetectedStream::~DetectedStream() = default;
+
+    Encoding DetectedStream::encoding() const
+    {
+        return detector_.encoding();
+    }
+
+    const std::vector<EncodingCandidate>& DetectedStream::candidates() const
+    {
+        return detector_.candidates();
+    }
+
+    size_t DetectedStream::byte_order_mark_size() const
+    {
+        return detector_.byte_order_mark_size();
+    }
+}
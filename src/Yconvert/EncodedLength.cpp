@@ -0,0 +1,31 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/EncodedLength.hpp"
+
+#include "Utf16Algorithms.hpp"
+#include "Utf8Algorithms.hpp"
+
+namespace Yconvert
+{
+    EncodedLength utf16_length_from_utf8(std::span<const char> utf8)
+    {
+        auto counts = Detail::count_well_formed_utf8(utf8.data(), utf8.size());
+        return {counts.utf16_units(), counts.bytes == utf8.size()};
+    }
+
+    EncodedLength utf8_length_from_utf16(std::span<const char16_t> utf16,
+                                         Endianness endianness)
+    {
+        auto size = utf16.size() * sizeof(char16_t);
+        auto counts = endianness == Endianness::NATIVE
+                      || endianness == Endianness::UNKNOWN
+                      ? Detail::count_utf16<false>(utf16.data(), size)
+                      : Detail::count_utf16<true>(utf16.data(), size);
+        return {counts.utf8_bytes, counts.bytes == size};
+    }
+}
@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <istream>
 #include "Yconvert/EncodingChecker.hpp"
+#include "EncodingNameTable.hpp"
 #include "YconvertThrow.hpp"
 
 namespace Yconvert
@@ -134,43 +135,360 @@ namespace Yconvert
             #endif
             };
 
-        typedef std::pair<std::string, Encoding> EncodingName;
+        using Detail::EncodingName;
 
-        EncodingName ENCODING_ALIASES[] = {
-            EncodingName("UTF-16", Encoding::UTF_16_NATIVE),
-            EncodingName("UTF-32", Encoding::UTF_32_NATIVE),
-            #ifdef YCONVERT_WIN_CODE_PAGES
-            EncodingName("WINDOWS-1250", Encoding::WIN_CP1250),
-            EncodingName("WINDOWS-1251", Encoding::WIN_CP1251),
-            EncodingName("WINDOWS-1252", Encoding::WIN_CP1252),
-            EncodingName("WINDOWS-1253", Encoding::WIN_CP1253),
-            EncodingName("WINDOWS-1254", Encoding::WIN_CP1254),
-            EncodingName("WINDOWS-1255", Encoding::WIN_CP1255),
-            EncodingName("WINDOWS-1256", Encoding::WIN_CP1256),
-            EncodingName("WINDOWS-1257", Encoding::WIN_CP1257),
-            EncodingName("WINDOWS-1258", Encoding::WIN_CP1258),
-            #endif
-            #ifdef YCONVERT_ISO_CODE_PAGES
-            EncodingName("LATIN1", Encoding::ISO_8859_1),
-            EncodingName("LATIN2", Encoding::ISO_8859_2),
-            EncodingName("LATIN3", Encoding::ISO_8859_3),
-            EncodingName("LATIN4", Encoding::ISO_8859_4),
-            EncodingName("LATIN5", Encoding::ISO_8859_9),
-            EncodingName("LATIN6", Encoding::ISO_8859_10),
-            EncodingName("LATIN7", Encoding::ISO_8859_13),
-            EncodingName("LATIN8", Encoding::ISO_8859_14),
-            EncodingName("LATIN9", Encoding::ISO_8859_15),
-            EncodingName("LATIN10", Encoding::ISO_8859_16),
-            #endif
+        /**
+         * @brief The names and aliases of the encodings.
+         *
+         * The aliases are mostly those in the IANA character set
+         * registry, in addition to a few that are common in practice.
+         * Names are compared case-insensitively.
+         */
+        constexpr EncodingName ENCODING_NAMES[] = {
+            {"UTF-8", Encoding::UTF_8},
+            {"UTF8", Encoding::UTF_8},
+            {"csUTF8", Encoding::UTF_8},
+            {"unicode-1-1-utf-8", Encoding::UTF_8},
+
+            {"UTF-16", Encoding::UTF_16_NATIVE},
+            {"UTF16", Encoding::UTF_16_NATIVE},
+            {"csUTF16", Encoding::UTF_16_NATIVE},
+            {"UCS-2", Encoding::UTF_16_NATIVE},
+            {"UTF-16LE", Encoding::UTF_16_LE},
+            {"UTF16LE", Encoding::UTF_16_LE},
+            {"csUTF16LE", Encoding::UTF_16_LE},
+            {"UCS-2LE", Encoding::UTF_16_LE},
+            {"UTF-16BE", Encoding::UTF_16_BE},
+            {"UTF16BE", Encoding::UTF_16_BE},
+            {"csUTF16BE", Encoding::UTF_16_BE},
+            {"UCS-2BE", Encoding::UTF_16_BE},
+
+            {"UTF-32", Encoding::UTF_32_NATIVE},
+            {"UTF32", Encoding::UTF_32_NATIVE},
+            {"csUTF32", Encoding::UTF_32_NATIVE},
+            {"UCS-4", Encoding::UTF_32_NATIVE},
+            {"UTF-32LE", Encoding::UTF_32_LE},
+            {"UTF32LE", Encoding::UTF_32_LE},
+            {"csUTF32LE", Encoding::UTF_32_LE},
+            {"UCS-4LE", Encoding::UTF_32_LE},
+            {"UTF-32BE", Encoding::UTF_32_BE},
+            {"UTF32BE", Encoding::UTF_32_BE},
+            {"csUTF32BE", Encoding::UTF_32_BE},
+            {"UCS-4BE", Encoding::UTF_32_BE},
+
+            {"ASCII", Encoding::ASCII},
+            {"US-ASCII", Encoding::ASCII},
+            {"iso-ir-6", Encoding::ASCII},
+            {"ANSI_X3.4-1968", Encoding::ASCII},
+            {"ANSI_X3.4-1986", Encoding::ASCII},
+            {"ISO_646.irv:1991", Encoding::ASCII},
+            {"ISO646-US", Encoding::ASCII},
+            {"us", Encoding::ASCII},
+            {"IBM367", Encoding::ASCII},
+            {"cp367", Encoding::ASCII},
+            {"csASCII", Encoding::ASCII},
+        #ifdef YCONVERT_ISO_CODE_PAGES
+            {"ISO-8859-1", Encoding::ISO_8859_1},
+            {"ISO_8859-1", Encoding::ISO_8859_1},
+            {"ISO_8859-1:1987", Encoding::ISO_8859_1},
+            {"ISO8859-1", Encoding::ISO_8859_1},
+            {"iso-ir-100", Encoding::ISO_8859_1},
+            {"latin1", Encoding::ISO_8859_1},
+            {"l1", Encoding::ISO_8859_1},
+            {"IBM819", Encoding::ISO_8859_1},
+            {"CP819", Encoding::ISO_8859_1},
+            {"csISOLatin1", Encoding::ISO_8859_1},
+
+            {"ISO-8859-2", Encoding::ISO_8859_2},
+            {"ISO_8859-2", Encoding::ISO_8859_2},
+            {"ISO_8859-2:1987", Encoding::ISO_8859_2},
+            {"ISO8859-2", Encoding::ISO_8859_2},
+            {"iso-ir-101", Encoding::ISO_8859_2},
+            {"latin2", Encoding::ISO_8859_2},
+            {"l2", Encoding::ISO_8859_2},
+            {"csISOLatin2", Encoding::ISO_8859_2},
+
+            {"ISO-8859-3", Encoding::ISO_8859_3},
+            {"ISO_8859-3", Encoding::ISO_8859_3},
+            {"ISO_8859-3:1988", Encoding::ISO_8859_3},
+            {"ISO8859-3", Encoding::ISO_8859_3},
+            {"iso-ir-109", Encoding::ISO_8859_3},
+            {"latin3", Encoding::ISO_8859_3},
+            {"l3", Encoding::ISO_8859_3},
+            {"csISOLatin3", Encoding::ISO_8859_3},
+
+            {"ISO-8859-4", Encoding::ISO_8859_4},
+            {"ISO_8859-4", Encoding::ISO_8859_4},
+            {"ISO_8859-4:1988", Encoding::ISO_8859_4},
+            {"ISO8859-4", Encoding::ISO_8859_4},
+            {"iso-ir-110", Encoding::ISO_8859_4},
+            {"latin4", Encoding::ISO_8859_4},
+            {"l4", Encoding::ISO_8859_4},
+            {"csISOLatin4", Encoding::ISO_8859_4},
+
+            {"ISO-8859-5", Encoding::ISO_8859_5},
+            {"ISO_8859-5", Encoding::ISO_8859_5},
+            {"ISO_8859-5:1988", Encoding::ISO_8859_5},
+            {"ISO8859-5", Encoding::ISO_8859_5},
+            {"iso-ir-144", Encoding::ISO_8859_5},
+            {"cyrillic", Encoding::ISO_8859_5},
+            {"csISOLatinCyrillic", Encoding::ISO_8859_5},
+
+            {"ISO-8859-6", Encoding::ISO_8859_6},
+            {"ISO_8859-6", Encoding::ISO_8859_6},
+            {"ISO_8859-6:1987", Encoding::ISO_8859_6},
+            {"ISO8859-6", Encoding::ISO_8859_6},
+            {"iso-ir-127", Encoding::ISO_8859_6},
+            {"ECMA-114", Encoding::ISO_8859_6},
+            {"ASMO-708", Encoding::ISO_8859_6},
+            {"arabic", Encoding::ISO_8859_6},
+            {"csISOLatinArabic", Encoding::ISO_8859_6},
+
+            {"ISO-8859-7", Encoding::ISO_8859_7},
+            {"ISO_8859-7", Encoding::ISO_8859_7},
+            {"ISO_8859-7:1987", Encoding::ISO_8859_7},
+            {"ISO8859-7", Encoding::ISO_8859_7},
+            {"iso-ir-126", Encoding::ISO_8859_7},
+            {"ELOT_928", Encoding::ISO_8859_7},
+            {"ECMA-118", Encoding::ISO_8859_7},
+            {"greek", Encoding::ISO_8859_7},
+            {"greek8", Encoding::ISO_8859_7},
+            {"csISOLatinGreek", Encoding::ISO_8859_7},
+
+            {"ISO-8859-8", Encoding::ISO_8859_8},
+            {"ISO_8859-8", Encoding::ISO_8859_8},
+            {"ISO_8859-8:1988", Encoding::ISO_8859_8},
+            {"ISO8859-8", Encoding::ISO_8859_8},
+            {"iso-ir-138", Encoding::ISO_8859_8},
+            {"hebrew", Encoding::ISO_8859_8},
+            {"csISOLatinHebrew", Encoding::ISO_8859_8},
+
+            {"ISO-8859-9", Encoding::ISO_8859_9},
+            {"ISO_8859-9", Encoding::ISO_8859_9},
+            {"ISO_8859-9:1989", Encoding::ISO_8859_9},
+            {"ISO8859-9", Encoding::ISO_8859_9},
+            {"iso-ir-148", Encoding::ISO_8859_9},
+            {"latin5", Encoding::ISO_8859_9},
+            {"l5", Encoding::ISO_8859_9},
+            {"csISOLatin5", Encoding::ISO_8859_9},
+
+            {"ISO-8859-10", Encoding::ISO_8859_10},
+            {"ISO_8859-10", Encoding::ISO_8859_10},
+            {"ISO_8859-10:1992", Encoding::ISO_8859_10},
+            {"ISO8859-10", Encoding::ISO_8859_10},
+            {"iso-ir-157", Encoding::ISO_8859_10},
+            {"latin6", Encoding::ISO_8859_10},
+            {"l6", Encoding::ISO_8859_10},
+            {"csISOLatin6", Encoding::ISO_8859_10},
+
+            {"ISO-8859-11", Encoding::ISO_8859_11},
+            {"ISO8859-11", Encoding::ISO_8859_11},
+            {"TIS-620", Encoding::ISO_8859_11},
+            {"csTIS620", Encoding::ISO_8859_11},
+
+            {"ISO-8859-13", Encoding::ISO_8859_13},
+            {"ISO8859-13", Encoding::ISO_8859_13},
+            {"latin7", Encoding::ISO_8859_13},
+            {"csISO885913", Encoding::ISO_8859_13},
+
+            {"ISO-8859-14", Encoding::ISO_8859_14},
+            {"ISO_8859-14", Encoding::ISO_8859_14},
+            {"ISO_8859-14:1998", Encoding::ISO_8859_14},
+            {"ISO8859-14", Encoding::ISO_8859_14},
+            {"iso-ir-199", Encoding::ISO_8859_14},
+            {"iso-celtic", Encoding::ISO_8859_14},
+            {"latin8", Encoding::ISO_8859_14},
+            {"l8", Encoding::ISO_8859_14},
+            {"csISO885914", Encoding::ISO_8859_14},
+
+            {"ISO-8859-15", Encoding::ISO_8859_15},
+            {"ISO_8859-15", Encoding::ISO_8859_15},
+            {"ISO8859-15", Encoding::ISO_8859_15},
+            {"Latin-9", Encoding::ISO_8859_15},
+            {"latin9", Encoding::ISO_8859_15},
+            {"csISO885915", Encoding::ISO_8859_15},
+
+            {"ISO-8859-16", Encoding::ISO_8859_16},
+            {"ISO_8859-16", Encoding::ISO_8859_16},
+            {"ISO_8859-16:2001", Encoding::ISO_8859_16},
+            {"ISO8859-16", Encoding::ISO_8859_16},
+            {"iso-ir-226", Encoding::ISO_8859_16},
+            {"latin10", Encoding::ISO_8859_16},
+            {"l10", Encoding::ISO_8859_16},
+            {"csISO885916", Encoding::ISO_8859_16},
+        #endif
+        #ifdef YCONVERT_MAC_CODE_PAGES
+            {"MAC-CYRILLIC", Encoding::MAC_CYRILLIC},
+            {"x-mac-cyrillic", Encoding::MAC_CYRILLIC},
+            {"MacCyrillic", Encoding::MAC_CYRILLIC},
+
+            {"MAC-GREEK", Encoding::MAC_GREEK},
+            {"x-mac-greek", Encoding::MAC_GREEK},
+            {"MacGreek", Encoding::MAC_GREEK},
+
+            {"MAC-ICELAND", Encoding::MAC_ICELAND},
+            {"x-mac-icelandic", Encoding::MAC_ICELAND},
+            {"MacIceland", Encoding::MAC_ICELAND},
+
+            {"MAC-LATIN2", Encoding::MAC_LATIN2},
+            {"x-mac-ce", Encoding::MAC_LATIN2},
+            {"MacCentralEurope", Encoding::MAC_LATIN2},
+
+            {"MAC-ROMAN", Encoding::MAC_ROMAN},
+            {"x-mac-roman", Encoding::MAC_ROMAN},
+            {"MacRoman", Encoding::MAC_ROMAN},
+            {"macintosh", Encoding::MAC_ROMAN},
+            {"mac", Encoding::MAC_ROMAN},
+            {"csMacintosh", Encoding::MAC_ROMAN},
+
+            {"MAC-TURKISH", Encoding::MAC_TURKISH},
+            {"x-mac-turkish", Encoding::MAC_TURKISH},
+            {"MacTurkish", Encoding::MAC_TURKISH},
+        #endif
+        #ifdef YCONVERT_DOS_CODE_PAGES
+            {"DOS-CP437", Encoding::DOS_CP437},
+            {"IBM437", Encoding::DOS_CP437},
+            {"cp437", Encoding::DOS_CP437},
+            {"437", Encoding::DOS_CP437},
+            {"csPC8CodePage437", Encoding::DOS_CP437},
+
+            {"DOS-CP737", Encoding::DOS_CP737},
+            {"IBM737", Encoding::DOS_CP737},
+            {"cp737", Encoding::DOS_CP737},
+
+            {"DOS-CP775", Encoding::DOS_CP775},
+            {"IBM775", Encoding::DOS_CP775},
+            {"cp775", Encoding::DOS_CP775},
+            {"csPC775Baltic", Encoding::DOS_CP775},
+
+            {"DOS-CP850", Encoding::DOS_CP850},
+            {"IBM850", Encoding::DOS_CP850},
+            {"cp850", Encoding::DOS_CP850},
+            {"850", Encoding::DOS_CP850},
+            {"csPC850Multilingual", Encoding::DOS_CP850},
+
+            {"DOS-CP852", Encoding::DOS_CP852},
+            {"IBM852", Encoding::DOS_CP852},
+            {"cp852", Encoding::DOS_CP852},
+            {"852", Encoding::DOS_CP852},
+            {"csPCp852", Encoding::DOS_CP852},
+
+            {"DOS-CP855", Encoding::DOS_CP855},
+            {"IBM855", Encoding::DOS_CP855},
+            {"cp855", Encoding::DOS_CP855},
+            {"855", Encoding::DOS_CP855},
+            {"csIBM855", Encoding::DOS_CP855},
+
+            {"DOS-CP857", Encoding::DOS_CP857},
+            {"IBM857", Encoding::DOS_CP857},
+            {"cp857", Encoding::DOS_CP857},
+            {"857", Encoding::DOS_CP857},
+            {"csIBM857", Encoding::DOS_CP857},
+
+            {"DOS-CP860", Encoding::DOS_CP860},
+            {"IBM860", Encoding::DOS_CP860},
+            {"cp860", Encoding::DOS_CP860},
+            {"860", Encoding::DOS_CP860},
+            {"csIBM860", Encoding::DOS_CP860},
+
+            {"DOS-CP861", Encoding::DOS_CP861},
+            {"IBM861", Encoding::DOS_CP861},
+            {"cp861", Encoding::DOS_CP861},
+            {"861", Encoding::DOS_CP861},
+            {"cp-is", Encoding::DOS_CP861},
+            {"csIBM861", Encoding::DOS_CP861},
+
+            {"DOS-CP862", Encoding::DOS_CP862},
+            {"IBM862", Encoding::DOS_CP862},
+            {"cp862", Encoding::DOS_CP862},
+            {"862", Encoding::DOS_CP862},
+            {"csPC862LatinHebrew", Encoding::DOS_CP862},
+
+            {"DOS-CP863", Encoding::DOS_CP863},
+            {"IBM863", Encoding::DOS_CP863},
+            {"cp863", Encoding::DOS_CP863},
+            {"863", Encoding::DOS_CP863},
+            {"csIBM863", Encoding::DOS_CP863},
+
+            {"DOS-CP864", Encoding::DOS_CP864},
+            {"IBM864", Encoding::DOS_CP864},
+            {"cp864", Encoding::DOS_CP864},
+            {"csIBM864", Encoding::DOS_CP864},
+
+            {"DOS-CP865", Encoding::DOS_CP865},
+            {"IBM865", Encoding::DOS_CP865},
+            {"cp865", Encoding::DOS_CP865},
+            {"865", Encoding::DOS_CP865},
+            {"csIBM865", Encoding::DOS_CP865},
+
+            {"DOS-CP866", Encoding::DOS_CP866},
+            {"IBM866", Encoding::DOS_CP866},
+            {"cp866", Encoding::DOS_CP866},
+            {"866", Encoding::DOS_CP866},
+            {"csIBM866", Encoding::DOS_CP866},
+
+            {"DOS-CP869", Encoding::DOS_CP869},
+            {"IBM869", Encoding::DOS_CP869},
+            {"cp869", Encoding::DOS_CP869},
+            {"869", Encoding::DOS_CP869},
+            {"cp-gr", Encoding::DOS_CP869},
+            {"csIBM869", Encoding::DOS_CP869},
+
+            {"DOS-CP874", Encoding::DOS_CP874},
+            {"cp874", Encoding::DOS_CP874},
+            {"windows-874", Encoding::DOS_CP874},
+            {"cswindows874", Encoding::DOS_CP874},
+        #endif
+        #ifdef YCONVERT_WIN_CODE_PAGES
+            {"WIN-CP1250", Encoding::WIN_CP1250},
+            {"windows-1250", Encoding::WIN_CP1250},
+            {"cp1250", Encoding::WIN_CP1250},
+            {"cswindows1250", Encoding::WIN_CP1250},
+
+            {"WIN-CP1251", Encoding::WIN_CP1251},
+            {"windows-1251", Encoding::WIN_CP1251},
+            {"cp1251", Encoding::WIN_CP1251},
+            {"cswindows1251", Encoding::WIN_CP1251},
+
+            {"WIN-CP1252", Encoding::WIN_CP1252},
+            {"windows-1252", Encoding::WIN_CP1252},
+            {"cp1252", Encoding::WIN_CP1252},
+            {"cswindows1252", Encoding::WIN_CP1252},
+
+            {"WIN-CP1253", Encoding::WIN_CP1253},
+            {"windows-1253", Encoding::WIN_CP1253},
+            {"cp1253", Encoding::WIN_CP1253},
+            {"cswindows1253", Encoding::WIN_CP1253},
+
+            {"WIN-CP1254", Encoding::WIN_CP1254},
+            {"windows-1254", Encoding::WIN_CP1254},
+            {"cp1254", Encoding::WIN_CP1254},
+            {"cswindows1254", Encoding::WIN_CP1254},
+
+            {"WIN-CP1255", Encoding::WIN_CP1255},
+            {"windows-1255", Encoding::WIN_CP1255},
+            {"cp1255", Encoding::WIN_CP1255},
+            {"cswindows1255", Encoding::WIN_CP1255},
+
+            {"WIN-CP1256", Encoding::WIN_CP1256},
+            {"windows-1256", Encoding::WIN_CP1256},
+            {"cp1256", Encoding::WIN_CP1256},
+            {"cswindows1256", Encoding::WIN_CP1256},
+
+            {"WIN-CP1257", Encoding::WIN_CP1257},
+            {"windows-1257", Encoding::WIN_CP1257},
+            {"cp1257", Encoding::WIN_CP1257},
+            {"cswindows1257", Encoding::WIN_CP1257},
+
+            {"WIN-CP1258", Encoding::WIN_CP1258},
+            {"windows-1258", Encoding::WIN_CP1258},
+            {"cp1258", Encoding::WIN_CP1258},
+            {"cswindows1258", Encoding::WIN_CP1258},
+        #endif
         };
 
-        void to_upper_case(std::string &str)
-        {
-            std::transform(str.begin(), str.end(), str.begin(), [](char c)
-            {
-                return 'a' <= c && c <= 'z' ? char(c - 32) : c;
-            });
-        }
+        constexpr auto ENCODING_NAME_TABLE
+            = Detail::make_encoding_name_table(ENCODING_NAMES);
     }
 
     const EncodingInfo& get_info(Encoding encoding)
@@ -191,20 +509,9 @@ namespace Yconvert
         return {&ENCODING_INFO[1], std::size(ENCODING_INFO) - 1};
     }
 
-    Encoding encoding_from_name(std::string name)
+    Encoding encoding_from_name(std::string_view name)
     {
-        to_upper_case(name);
-        using std::begin;
-        using std::end;
-        auto it = std::find_if(begin(ENCODING_INFO), end(ENCODING_INFO),
-                               [&](auto& i){return i.name == name;});
-        if (it != end(ENCODING_INFO))
-            return it->encoding;
-        auto jt = std::find_if(begin(ENCODING_ALIASES), end(ENCODING_ALIASES),
-                               [&](auto& i) {return i.first == name;});
-        if (jt != end(ENCODING_ALIASES))
-            return jt->second;
-        return Encoding::UNKNOWN;
+        return ENCODING_NAME_TABLE.find(name);
     }
 
     Encoding determine_encoding_from_byte_order_mark(const char* str, size_t len)
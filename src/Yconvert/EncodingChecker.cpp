@@ -6,6 +6,7 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include "Yconvert/EncodingChecker.hpp"
+#include "Yconvert/MappedFile.hpp"
 #include "MakeEncodersAndDecoders.hpp"
 
 namespace Yconvert
@@ -71,4 +72,15 @@ namespace Yconvert
             length - bytes, &chr, 1).second;
         return count == 1 && chr == 0;
     }
+
+    std::pair<size_t, size_t>
+    EncodingChecker::count_valid_codepoints(const MappedFile& file) const
+    {
+        return count_valid_codepoints(file.data(), file.size());
+    }
+
+    bool EncodingChecker::check_encoding(const MappedFile& file) const
+    {
+        return check_encoding(file.data(), file.size());
+    }
 }
@@ -0,0 +1,169 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/EncodingDetection.hpp"
+
+#include <algorithm>
+#include "EncodingStatistics.hpp"
+
+namespace Yconvert
+{
+    std::vector<EncodingCandidate>
+    detect_encodings(const void* buffer, size_t size, size_t max_size)
+    {
+        auto bytes = static_cast<const char*>(buffer);
+        auto bom_encoding = determine_encoding_from_byte_order_mark(bytes, size);
+        size_t offset = 0;
+        if (bom_encoding != Encoding::UNKNOWN)
+            offset = get_info(bom_encoding).byte_order_mark.size();
+
+        Detail::EncodingStatistics stats;
+        auto end = std::min(size, max_size);
+        if (end > offset)
+            stats.add(bytes + offset, end - offset);
+        if (end == size)
+            stats.finish();
+
+        auto result = Detail::rank_encodings(stats);
+        if (bom_encoding != Encoding::UNKNOWN)
+        {
+            std::erase_if(result, [&](const auto& c)
+            {
+                return c.encoding == bom_encoding;
+            });
+            result.insert(result.begin(), {bom_encoding, 1.0});
+        }
+        return result;
+    }
+
+    EncodingDetector::EncodingDetector(size_t max_size, double threshold)
+        : stats_(std::make_unique<Detail::EncodingStatistics>()),
+          max_size_(max_size),
+          threshold_(threshold)
+    {}
+
+    EncodingDetector::EncodingDetector(EncodingDetector&&) noexcept = default;
+
+    EncodingDetector::~EncodingDetector() = default;
+
+    EncodingDetector&
+    EncodingDetector::operator=(EncodingDetector&&) noexcept = default;
+
+    bool EncodingDetector::add(const void* data, size_t size)
+    {
+        if (done_)
+            return true;
+
+        auto bytes = static_cast<const char*>(data);
+        size = std::min(size, max_size_ - size_);
+        if (!bom_checked_)
+        {
+            // Collect the first bytes until it's possible to tell if
+            // there is a byte-order mark.
+            auto n = std::min(size, sizeof(head_) - size_);
+            std::copy_n(bytes, n, head_ + size_);
+            size_ += n;
+            bytes += n;
+            size -= n;
+            if (size_ < sizeof(head_) && size_ < max_size_)
+                return false;
+            check_byte_order_mark();
+            if (done_)
+                return true;
+        }
+
+        if (size != 0)
+        {
+            stats_->add(bytes, size);
+            size_ += size;
+        }
+        update(size_ == max_size_);
+        return done_;
+    }
+
+    void EncodingDetector::finish()
+    {
+        if (done_)
+            return;
+        if (!bom_checked_)
+        {
+            check_byte_order_mark();
+            if (done_)
+                return;
+        }
+        stats_->finish();
+        update(true);
+    }
+
+    bool EncodingDetector::is_done() const
+    {
+        return done_;
+    }
+
+    Encoding EncodingDetector::encoding() const
+    {
+        auto& candidates = this->candidates();
+        return candidates.empty() ? Encoding::UNKNOWN
+                                  : candidates.front().encoding;
+    }
+
+    const std::vector<EncodingCandidate>& EncodingDetector::candidates() const
+    {
+        if (!is_ranked_)
+            rank();
+        return candidates_;
+    }
+
+    size_t EncodingDetector::byte_order_mark_size() const
+    {
+        return bom_size_;
+    }
+
+    size_t EncodingDetector::size() const
+    {
+        return size_;
+    }
+
+    void EncodingDetector::check_byte_order_mark()
+    {
+        bom_checked_ = true;
+        auto bom_encoding = determine_encoding_from_byte_order_mark(head_, size_);
+        if (bom_encoding != Encoding::UNKNOWN)
+        {
+            bom_size_ = get_info(bom_encoding).byte_order_mark.size();
+            candidates_ = {{bom_encoding, 1.0}};
+            done_ = true;
+            return;
+        }
+        stats_->add(head_, size_);
+    }
+
+    void EncodingDetector::update(bool final)
+    {
+        // Ranking the encodings is considerably more expensive than
+        // gathering statistics for a small chunk, it is therefore
+        // postponed until the encoding can be decided. Invalid UTF-8
+        // only rules out UTF-8, the remaining candidates need as much
+        // text as any other.
+        if (!final && size_ < MIN_DECISION_SIZE)
+        {
+            is_ranked_ = false;
+            return;
+        }
+
+        rank();
+        done_ = final
+                || (!candidates_.empty()
+                    && candidates_.front().confidence >= threshold_);
+    }
+
+    void EncodingDetector::rank() const
+    {
+        candidates_ = Detail::rank_encodings(*stats_);
+        is_ranked_ = true;
+    }
+}
@@ -0,0 +1,178 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include "Yconvert/Encoding.hpp"
+
+namespace Yconvert::Detail
+{
+    struct EncodingName
+    {
+        std::string_view name;
+        Encoding encoding;
+    };
+
+    constexpr char fold_case(char c)
+    {
+        return 'A' <= c && c <= 'Z' ? char(c + 32) : c;
+    }
+
+    constexpr bool equals_ignoring_case(std::string_view a, std::string_view b)
+    {
+        if (a.size() != b.size())
+            return false;
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            if (fold_case(a[i]) != fold_case(b[i]))
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns the FNV-1a hash of the case-folded @a name, mixed
+     *  with @a seed and finalized so that the low bits depend on all
+     *  the characters.
+     */
+    constexpr uint32_t hash_name(std::string_view name, uint32_t seed)
+    {
+        uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+        for (auto c : name)
+        {
+            hash ^= uint8_t(fold_case(c));
+            hash *= 16777619u;
+        }
+        hash ^= hash >> 16;
+        hash *= 0x85EBCA6Bu;
+        hash ^= hash >> 13;
+        hash *= 0xC2B2AE35u;
+        hash ^= hash >> 16;
+        return hash;
+    }
+
+    /**
+     * @brief A perfect hash table that maps case-insensitive names to
+     *  encodings.
+     *
+     * The names are distributed over buckets by their hash with seed 0.
+     * Each bucket has its own seed, chosen when the table is built, that
+     * places all names in the bucket in separate slots. A lookup
+     * therefore computes two hashes and compares one name.
+     */
+    template <size_t N>
+    struct EncodingNameTable
+    {
+        static constexpr size_t SLOT_COUNT = std::bit_ceil(2 * N);
+        static constexpr size_t BUCKET_COUNT = std::max<size_t>(SLOT_COUNT / 4, 1);
+        static constexpr uint16_t EMPTY = UINT16_MAX;
+
+        std::array<EncodingName, N> names = {};
+        std::array<uint16_t, BUCKET_COUNT> seeds = {};
+        std::array<uint16_t, SLOT_COUNT> slots = {};
+
+        [[nodiscard]]
+        constexpr Encoding find(std::string_view name) const
+        {
+            auto bucket = hash_name(name, 0) % BUCKET_COUNT;
+            auto slot = hash_name(name, seeds[bucket]) % SLOT_COUNT;
+            auto index = slots[slot];
+            if (index != EMPTY && equals_ignoring_case(names[index].name, name))
+                return names[index].encoding;
+            return Encoding::UNKNOWN;
+        }
+    };
+
+    /**
+     * @brief Builds the perfect hash table for @a names.
+     *
+     * Meant to be evaluated at compile time, where the exceptions
+     * become compilation errors.
+     */
+    template <size_t N>
+    constexpr EncodingNameTable<N>
+    make_encoding_name_table(const EncodingName (&names)[N])
+    {
+        using Table = EncodingNameTable<N>;
+        static_assert(N < Table::EMPTY);
+        Table table;
+        table.slots.fill(Table::EMPTY);
+        for (size_t i = 0; i < N; ++i)
+        {
+            table.names[i] = names[i];
+            for (size_t j = 0; j < i; ++j)
+            {
+                if (equals_ignoring_case(names[i].name, names[j].name))
+                    throw std::logic_error("Duplicate encoding name.");
+            }
+        }
+
+        std::array<size_t, N> buckets = {};
+        std::array<size_t, Table::BUCKET_COUNT> bucket_sizes = {};
+        for (size_t i = 0; i < N; ++i)
+        {
+            buckets[i] = hash_name(names[i].name, 0) % Table::BUCKET_COUNT;
+            ++bucket_sizes[buckets[i]];
+        }
+
+        // Place the largest buckets first, while there are many free
+        // slots.
+        std::array<size_t, Table::BUCKET_COUNT> order = {};
+        for (size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::sort(order.begin(), order.end(), [&](auto a, auto b)
+        {
+            if (bucket_sizes[a] != bucket_sizes[b])
+                return bucket_sizes[a] > bucket_sizes[b];
+            return a < b;
+        });
+
+        for (auto bucket : order)
+        {
+            if (bucket_sizes[bucket] == 0)
+                break;
+
+            std::array<size_t, N> members = {};
+            size_t count = 0;
+            for (size_t i = 0; i < N; ++i)
+            {
+                if (buckets[i] == bucket)
+                    members[count++] = i;
+            }
+
+            for (uint32_t seed = 1;; ++seed)
+            {
+                if (seed == UINT16_MAX)
+                    throw std::logic_error("No seed found for bucket.");
+
+                std::array<size_t, N> slots = {};
+                bool ok = true;
+                for (size_t k = 0; k < count && ok; ++k)
+                {
+                    slots[k] = hash_name(names[members[k]].name, seed)
+                               % Table::SLOT_COUNT;
+                    ok = table.slots[slots[k]] == Table::EMPTY
+                         && std::find(slots.begin(), slots.begin() + k, slots[k])
+                            == slots.begin() + k;
+                }
+                if (!ok)
+                    continue;
+
+                table.seeds[bucket] = uint16_t(seed);
+                for (size_t k = 0; k < count; ++k)
+                    table.slots[slots[k]] = uint16_t(members[k]);
+                break;
+            }
+        }
+        return table;
+    }
+}
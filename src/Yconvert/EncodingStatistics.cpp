@@ -0,0 +1,539 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "EncodingStatistics.hpp"
+
+#include <algorithm>
+#include <bit>
+#include "CodePageModels.hpp"
+#include "SimdDefinitions.hpp"
+#include "Utf16Algorithms.hpp"
+#include "Utf32Algorithms.hpp"
+#include "Utf8Algorithms.hpp"
+
+namespace Yconvert
+{
+    namespace Detail
+    {
+        namespace
+        {
+            /**
+             * @brief The number of bytes whose statistics are gathered
+             *  together, small enough for the block to remain in the L1
+             *  cache while it is checked for each UTF encoding.
+             */
+            constexpr size_t STATISTICS_BLOCK_SIZE = 16 * 1024;
+
+            /**
+             * @brief Invalid bytes this close to the end of a chunk may
+             *  be the start of a character that is completed in the next
+             *  chunk.
+             */
+            constexpr size_t MAX_INCOMPLETE_SIZE = 3;
+
+            constexpr auto SWAP_LE = IS_BIG_ENDIAN;
+            constexpr auto SWAP_BE = IS_LITTLE_ENDIAN;
+
+            size_t count_valid_utf8_bytes(const char* data, size_t size)
+            {
+                return count_utf8(data, size).bytes;
+            }
+
+            template <bool SWAP_BYTES>
+            size_t count_valid_utf16_bytes(const char* data, size_t size)
+            {
+                return count_utf16<SWAP_BYTES>(data, size).bytes;
+            }
+
+            template <bool SWAP_BYTES>
+            size_t count_valid_utf32_bytes(const char* data, size_t size)
+            {
+                // count_valid_utf32 stops at zeros, which are valid here.
+                size_t offset = 0;
+                while (true)
+                {
+                    offset += count_valid_utf32<SWAP_BYTES>(
+                        data + offset, size - offset).second;
+                    if (size - offset < 4
+                        || data[offset] != 0 || data[offset + 1] != 0
+                        || data[offset + 2] != 0 || data[offset + 3] != 0)
+                    {
+                        return offset;
+                    }
+                    offset += 4;
+                }
+            }
+
+            /**
+             * @brief Replaces count_valid_utf16_bytes for blocks without
+             *  bytes in the range 0xD8-0xDF, where there can't be any
+             *  surrogates.
+             */
+            size_t count_utf16_bytes_without_surrogates(const char*, size_t size)
+            {
+                return size & ~size_t(1);
+            }
+
+            /**
+             * @brief Updates @a validity with the next @a size bytes.
+             *
+             * @a count returns the number of bytes in the valid prefix of
+             * a buffer. @a block_count does the same for the remainder
+             * of @a data, and may take shortcuts based on properties of
+             * the block.
+             */
+            template <typename CountFunc, typename BlockCountFunc>
+            void update_validity(UtfValidity& validity,
+                                 const char* data, size_t size,
+                                 CountFunc count, BlockCountFunc block_count)
+            {
+                if (!validity.valid || size == 0)
+                    return;
+
+                if (validity.carry_size != 0)
+                {
+                    // Complete the character from the previous chunk.
+                    auto temp = validity.carry;
+                    auto n = std::min(size, temp.size() - validity.carry_size);
+                    std::copy_n(data, n, temp.data() + validity.carry_size);
+                    auto temp_size = validity.carry_size + n;
+                    auto valid = count(temp.data(), temp_size);
+                    if (valid < validity.carry_size)
+                    {
+                        if (valid == 0 && n == size
+                            && temp_size <= MAX_INCOMPLETE_SIZE)
+                        {
+                            validity.carry = temp;
+                            validity.carry_size = uint8_t(temp_size);
+                        }
+                        else
+                        {
+                            validity.valid = false;
+                        }
+                        return;
+                    }
+                    auto consumed = valid - validity.carry_size;
+                    validity.carry_size = 0;
+                    data += consumed;
+                    size -= consumed;
+                }
+
+                auto valid = block_count(data, size);
+                auto rest = size - valid;
+                if (rest == 0)
+                    return;
+                if (rest > MAX_INCOMPLETE_SIZE)
+                {
+                    validity.valid = false;
+                    return;
+                }
+                std::copy_n(data + valid, rest, validity.carry.data());
+                validity.carry_size = uint8_t(rest);
+            }
+
+            template <typename CountFunc>
+            void update_validity(UtfValidity& validity,
+                                 const char* data, size_t size,
+                                 CountFunc count)
+            {
+                update_validity(validity, data, size, count, count);
+            }
+        }
+
+        void EncodingStatistics::add(const void* data, size_t size)
+        {
+            auto bytes = static_cast<const char*>(data);
+            while (size != 0)
+            {
+                auto n = std::min(size, STATISTICS_BLOCK_SIZE);
+                add_block(bytes, n);
+                bytes += n;
+                size -= n;
+            }
+        }
+
+        void EncodingStatistics::finish()
+        {
+            for (auto& validity : validity_)
+            {
+                if (validity.carry_size != 0)
+                    validity.valid = false;
+            }
+        }
+
+        size_t EncodingStatistics::size() const
+        {
+            return size_;
+        }
+
+        const std::array<size_t, 256>& EncodingStatistics::histogram() const
+        {
+            return histogram_;
+        }
+
+        const std::array<size_t, 256>&
+        EncodingStatistics::histogram(size_t position) const
+        {
+            return position_histograms_[position % 2];
+        }
+
+        size_t EncodingStatistics::zeros(size_t position) const
+        {
+            return zeros_[position % 4];
+        }
+
+        bool EncodingStatistics::is_valid(UtfKind kind) const
+        {
+            return validity_[size_t(kind)].valid;
+        }
+
+        const std::vector<uint32_t>& EncodingStatistics::pairs() const
+        {
+            return pairs_;
+        }
+
+        void EncodingStatistics::add_block(const char* data, size_t size)
+        {
+            // Four histograms break the dependency between consecutive
+            // increments of the same counter. counts[k] has the bytes at
+            // offsets k modulo 4 from the start of the block.
+            uint32_t counts[4][256] = {};
+            size_t i = 0;
+            for (; i + 4 <= size; i += 4)
+            {
+                ++counts[0][uint8_t(data[i])];
+                ++counts[1][uint8_t(data[i + 1])];
+                ++counts[2][uint8_t(data[i + 2])];
+                ++counts[3][uint8_t(data[i + 3])];
+            }
+            for (; i < size; ++i)
+                ++counts[i % 4][uint8_t(data[i])];
+            auto& even = position_histograms_[size_ % 2];
+            auto& odd = position_histograms_[(size_ + 1) % 2];
+            size_t surrogate_bytes = 0;
+            size_t non_ascii_bytes = 0;
+            for (size_t j = 0; j < 256; ++j)
+            {
+                even[j] += counts[0][j] + counts[2][j];
+                odd[j] += counts[1][j] + counts[3][j];
+                auto count = counts[0][j] + counts[1][j] + counts[2][j] + counts[3][j];
+                histogram_[j] += count;
+                if (0xD8 <= j && j <= 0xDF)
+                    surrogate_bytes += count;
+                if (0x80 <= j)
+                    non_ascii_bytes += count;
+            }
+
+            i = 0;
+        #ifdef YCONVERT_SSE2
+            const auto zero = _mm_setzero_si128();
+            for (; i + 16 <= size; i += 16)
+            {
+                auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                auto mask = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)));
+                if (mask == 0)
+                    continue;
+                // Bit j in mask is byte j, i.e. every fourth bit is at
+                // the same position modulo 4.
+                auto base = size_ + i;
+                for (uint32_t k = 0; k < 4; ++k)
+                    zeros_[(base + k) % 4] += size_t(std::popcount(mask & (0x1111u << k)));
+            }
+        #endif
+            for (; i < size; ++i)
+            {
+                if (data[i] == 0)
+                    ++zeros_[(size_ + i) % 4];
+            }
+
+            update_validity(validity_[size_t(UtfKind::UTF_8)], data, size,
+                            count_valid_utf8_bytes);
+            if (surrogate_bytes == 0)
+            {
+                update_validity(validity_[size_t(UtfKind::UTF_16_LE)], data, size,
+                                count_valid_utf16_bytes<SWAP_LE>,
+                                count_utf16_bytes_without_surrogates);
+                update_validity(validity_[size_t(UtfKind::UTF_16_BE)], data, size,
+                                count_valid_utf16_bytes<SWAP_BE>,
+                                count_utf16_bytes_without_surrogates);
+            }
+            else
+            {
+                update_validity(validity_[size_t(UtfKind::UTF_16_LE)], data, size,
+                                count_valid_utf16_bytes<SWAP_LE>);
+                update_validity(validity_[size_t(UtfKind::UTF_16_BE)], data, size,
+                                count_valid_utf16_bytes<SWAP_BE>);
+            }
+            update_validity(validity_[size_t(UtfKind::UTF_32_LE)], data, size,
+                            count_valid_utf32_bytes<SWAP_LE>);
+            update_validity(validity_[size_t(UtfKind::UTF_32_BE)], data, size,
+                            count_valid_utf32_bytes<SWAP_BE>);
+            if (non_ascii_bytes != 0 || (last_byte_ & 0x80u))
+                add_pairs(data, size);
+            else
+                last_byte_ = uint8_t(data[size - 1]);
+            size_ += size;
+        }
+
+        void EncodingStatistics::add_pairs(const char* data, size_t size)
+        {
+            if (pairs_.empty())
+                pairs_.resize(256 * 256);
+            auto pairs = pairs_.data();
+            auto bytes = reinterpret_cast<const uint8_t*>(data);
+
+            // The first byte of the text doesn't have a predecessor.
+            size_t i = size_ == 0 ? 1 : 0;
+        #ifdef YCONVERT_SSE2
+            auto previous = i == 0 ? last_byte_ : bytes[0];
+            for (; i + 16 <= size; i += 16)
+            {
+                auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+                auto mask = uint32_t(_mm_movemask_epi8(v));
+                // A pair is counted if either byte is non-ASCII, i.e. bit
+                // j is set if byte j or the byte before it is non-ASCII.
+                auto pair_mask = (mask | (mask << 1) | (previous >> 7)) & 0xFFFFu;
+                previous = bytes[i + 15];
+                while (pair_mask != 0)
+                {
+                    auto j = i + size_t(std::countr_zero(pair_mask));
+                    auto first = j == 0 ? last_byte_ : bytes[j - 1];
+                    ++pairs[first * 256u + bytes[j]];
+                    pair_mask &= pair_mask - 1;
+                }
+            }
+        #endif
+            for (; i < size; ++i)
+            {
+                auto first = i == 0 ? last_byte_ : bytes[i - 1];
+                if ((first | bytes[i]) & 0x80u)
+                    ++pairs[first * 256u + bytes[i]];
+            }
+            last_byte_ = bytes[size - 1];
+        }
+
+        namespace
+        {
+            size_t count_bytes(const EncodingStatistics& stats,
+                               unsigned first, unsigned last)
+            {
+                auto& histogram = stats.histogram();
+                size_t count = 0;
+                for (auto i = first; i <= last; ++i)
+                    count += histogram[i];
+                return count;
+            }
+
+            /**
+             * @brief Returns the number of control characters that rarely
+             *  occur in text, i.e. all except tab, line feed, form feed,
+             *  carriage return and escape.
+             */
+            size_t count_unusual_controls(const EncodingStatistics& stats)
+            {
+                auto& histogram = stats.histogram();
+                size_t count = 0;
+                for (unsigned i = 1; i < 0x20; ++i)
+                {
+                    if (i != '\t' && i != '\n' && i != '\f' && i != '\r'
+                        && i != 0x1B)
+                    {
+                        count += histogram[i];
+                    }
+                }
+                return count + histogram[0x7F];
+            }
+
+            /**
+             * @brief How much the asymmetry between the high and low bytes
+             *  counts compared to zero bytes as evidence of UTF-16.
+             */
+            constexpr double UTF16_ASYMMETRY_WEIGHT = 0.5;
+
+            /**
+             * @brief The number of UTF-16 code units at which the
+             *  asymmetry between high and low bytes counts half.
+             */
+            constexpr double UTF16_ASYMMETRY_HALF_UNITS = 20;
+
+            double ratio(size_t a, size_t b)
+            {
+                return b == 0 ? 0.0 : double(a) / double(b);
+            }
+
+            /**
+             * @brief Returns the probability that two bytes drawn without
+             *  replacement from @a histogram are equal.
+             */
+            double get_concentration(const std::array<size_t, 256>& histogram)
+            {
+                size_t n = 0;
+                double sum = 0;
+                for (auto count : histogram)
+                {
+                    n += count;
+                    sum += double(count) * double(count - (count != 0));
+                }
+                return n < 2 ? 0.0 : sum / (double(n) * double(n - 1));
+            }
+
+            /**
+             * @brief Returns how much more concentrated the bytes at the
+             *  @a high positions are than the bytes at the other
+             *  positions, from 0 (not at all) to 1.
+             *
+             * The high bytes of UTF-16 code units are concentrated in a
+             * few script blocks, e.g. 0x4E-0x9F for CJK ideographs,
+             * while the low bytes are spread out. In single-byte text,
+             * the bytes at even and odd offsets are equally concentrated,
+             * but a short text can be asymmetric by chance. The result is
+             * therefore scaled down for short texts.
+             */
+            double get_utf16_asymmetry(const EncodingStatistics& stats,
+                                       size_t high)
+            {
+                auto high_concentration = get_concentration(stats.histogram(high));
+                auto low_concentration = get_concentration(stats.histogram(high + 1));
+                if (high_concentration == 0)
+                    return 0.0;
+                auto units = double(stats.size() / 2);
+                return std::max(0.0, 1.0 - low_concentration / high_concentration)
+                       * units / (units + UTF16_ASYMMETRY_HALF_UNITS);
+            }
+
+            /**
+             * @brief Returns the average bigram score of the byte pairs
+             *  in @a stats in each of the compiled-in code pages.
+             */
+            std::vector<std::pair<Encoding, double>>
+            score_code_pages(const EncodingStatistics& stats)
+            {
+                std::vector<std::pair<Encoding, double>> result;
+                auto& pairs = stats.pairs();
+                if (pairs.empty())
+                    return result;
+
+                // Collect the pairs that occur in one pass, then score
+                // them in each code page.
+                std::vector<std::pair<uint16_t, uint32_t>> occurring;
+                size_t total = 0;
+                for (size_t i = 0; i < pairs.size(); ++i)
+                {
+                    if (pairs[i] != 0)
+                    {
+                        occurring.emplace_back(uint16_t(i), pairs[i]);
+                        total += pairs[i];
+                    }
+                }
+                if (total == 0)
+                    return result;
+
+                for (auto* model = CODE_PAGE_MODELS; model->classes; ++model)
+                {
+                    auto classes = model->classes;
+                    int64_t sum = 0;
+                    for (auto [pair, count] : occurring)
+                    {
+                        auto a = classes[pair >> 8];
+                        auto b = classes[pair & 0xFFu];
+                        sum += int64_t(count) * CHAR_CLASS_SCORES[a][b];
+                    }
+                    result.emplace_back(model->encoding, double(sum) / double(total));
+                }
+                return result;
+            }
+        }
+
+        std::vector<EncodingCandidate>
+        rank_encodings(const EncodingStatistics& stats)
+        {
+            std::vector<EncodingCandidate> result;
+            const auto size = stats.size();
+            if (size == 0)
+                return result;
+
+            const auto zeros = stats.zeros(0) + stats.zeros(1)
+                               + stats.zeros(2) + stats.zeros(3);
+            const auto non_ascii = count_bytes(stats, 0x80, 0xFF);
+            // Text has few zeros and unusual control characters,
+            // binary data has many.
+            const auto text_factor
+                = (1.0 - ratio(zeros, size))
+                  * (1.0 - std::min(1.0, 4 * ratio(count_unusual_controls(stats), size)));
+
+            auto add = [&](Encoding encoding, double confidence)
+            {
+                if (confidence > 0)
+                    result.push_back({encoding, confidence});
+            };
+
+            const bool is_utf8 = stats.is_valid(UtfKind::UTF_8);
+            if (is_utf8)
+                add(Encoding::UTF_8, (non_ascii != 0 ? 0.99 : 0.9) * text_factor);
+            if (non_ascii == 0)
+                add(Encoding::ASCII, 0.85 * text_factor);
+
+            // In UTF-16 text where most characters are from the first 256
+            // code points, every other byte is zero. In other UTF-16
+            // text, e.g. Chinese, the high bytes are at least far more
+            // concentrated than the low bytes.
+            if (size >= 2)
+            {
+                auto units = size / 2;
+                auto even = ratio(stats.zeros(0) + stats.zeros(2), units);
+                auto odd = ratio(stats.zeros(1) + stats.zeros(3), units);
+                if (stats.is_valid(UtfKind::UTF_16_LE))
+                {
+                    auto evidence = std::max({0.0, odd - even,
+                                              UTF16_ASYMMETRY_WEIGHT
+                                              * get_utf16_asymmetry(stats, 1)});
+                    add(Encoding::UTF_16_LE, 0.2 + 0.79 * evidence);
+                }
+                if (stats.is_valid(UtfKind::UTF_16_BE))
+                {
+                    auto evidence = std::max({0.0, even - odd,
+                                              UTF16_ASYMMETRY_WEIGHT
+                                              * get_utf16_asymmetry(stats, 0)});
+                    add(Encoding::UTF_16_BE, 0.2 + 0.79 * evidence);
+                }
+            }
+
+            // Valid UTF-32 always has a zero in the most significant byte,
+            // and usually also in the next one.
+            if (size >= 4)
+            {
+                auto units = size / 4;
+                if (stats.is_valid(UtfKind::UTF_32_LE))
+                    add(Encoding::UTF_32_LE, 0.5 + 0.49 * ratio(stats.zeros(2), units));
+                if (stats.is_valid(UtfKind::UTF_32_BE))
+                    add(Encoding::UTF_32_BE, 0.5 + 0.49 * ratio(stats.zeros(1), units));
+            }
+
+            // Non-ASCII text that is valid UTF-8 is unlikely to be in
+            // a single-byte code page. Text without non-ASCII bytes is
+            // equally valid in all of them, they are therefore only
+            // ranked when there are non-ASCII bytes.
+            if (non_ascii != 0)
+            {
+                auto single_byte = (is_utf8 ? 0.3 : 0.6) * text_factor;
+                for (auto& [encoding, score] : score_code_pages(stats))
+                {
+                    // The average score is in the range -10 to 3, where
+                    // text in the right code page usually scores above 0.
+                    add(encoding, single_byte * std::clamp((score + 6) / 9, 0.05, 1.0));
+                }
+            }
+
+            std::stable_sort(result.begin(), result.end(),
+                             [](const auto& a, const auto& b)
+                             {
+                                 return a.confidence > b.confidence;
+                             });
+            return result;
+        }
+    }
+}
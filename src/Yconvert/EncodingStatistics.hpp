@@ -0,0 +1,134 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Yconvert/EncodingDetection.hpp"
+
+namespace Yconvert
+{
+    namespace Detail
+    {
+        /**
+         * @brief The UTF encodings whose validity EncodingStatistics
+         *  tracks.
+         */
+        enum class UtfKind
+        {
+            UTF_8,
+            UTF_16_LE,
+            UTF_16_BE,
+            UTF_32_LE,
+            UTF_32_BE,
+            COUNT
+        };
+
+        /**
+         * @brief Tracks whether a sequence of chunks is valid in a UTF
+         *  encoding.
+         *
+         * A character that is split between two chunks is carried over
+         * and completed with the first bytes of the next chunk.
+         */
+        struct UtfValidity
+        {
+            bool valid = true;
+            uint8_t carry_size = 0;
+            std::array<char, 8> carry = {};
+        };
+
+        /**
+         * @brief Statistics that the encoding of a text is determined from.
+         *
+         * The statistics are gathered from one or more chunks of text.
+         * Each chunk is processed in blocks that fit in the L1 cache: the
+         * byte histogram and zero counts are computed for a block, then
+         * the block is checked for each of the UTF encodings that it
+         * still may be in. Finally, the pairs of bytes around non-ASCII
+         * bytes are counted for the single-byte code pages.
+         */
+        class EncodingStatistics
+        {
+        public:
+            /**
+             * @brief Adds the @a size bytes in @a data to the statistics.
+             */
+            void add(const void* data, size_t size);
+
+            /**
+             * @brief Informs the statistics that there is no more text.
+             *
+             * Incomplete characters at the end of the text make it
+             * invalid in the corresponding UTF encodings.
+             */
+            void finish();
+
+            /**
+             * @brief Returns the number of bytes that have been added.
+             */
+            [[nodiscard]]
+            size_t size() const;
+
+            [[nodiscard]]
+            const std::array<size_t, 256>& histogram() const;
+
+            /**
+             * @brief Returns the histogram of the bytes at offsets where
+             *  the offset modulo 2 is @a position.
+             */
+            [[nodiscard]]
+            const std::array<size_t, 256>& histogram(size_t position) const;
+
+            /**
+             * @brief Returns the number of zero bytes at offsets where
+             *  the offset modulo 4 is @a position.
+             */
+            [[nodiscard]]
+            size_t zeros(size_t position) const;
+
+            /**
+             * @brief Returns true if the text so far is valid in @a kind.
+             */
+            [[nodiscard]]
+            bool is_valid(UtfKind kind) const;
+
+            /**
+             * @brief Returns the number of times each pair of consecutive
+             *  bytes occurs in the text, indexed by the first byte times
+             *  256 plus the second byte.
+             *
+             * Only pairs where at least one of the bytes is non-ASCII are
+             * counted, the result is empty if all bytes are ASCII.
+             */
+            [[nodiscard]]
+            const std::vector<uint32_t>& pairs() const;
+        private:
+            void add_block(const char* data, size_t size);
+
+            void add_pairs(const char* data, size_t size);
+
+            size_t size_ = 0;
+            std::array<size_t, 256> histogram_ = {};
+            std::array<std::array<size_t, 256>, 2> position_histograms_ = {};
+            std::array<size_t, 4> zeros_ = {};
+            std::array<UtfValidity, size_t(UtfKind::COUNT)> validity_ = {};
+            std::vector<uint32_t> pairs_;
+            uint8_t last_byte_ = 0;
+        };
+
+        /**
+         * @brief Computes the confidence of each encoding from @a stats
+         *  and returns the encodings with a non-zero confidence, ordered
+         *  from most to least likely.
+         */
+        std::vector<EncodingCandidate>
+        rank_encodings(const EncodingStatistics& stats);
+    }
+}
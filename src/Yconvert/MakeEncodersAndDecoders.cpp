@@ -7,6 +7,10 @@
 //****************************************************************************
 #include "MakeEncodersAndDecoders.hpp"
 
+#include <cstddef>
+#include <new>
+
+#include "Yconvert/CodepointIterator.hpp"
 #include "CodePageDecoder.hpp"
 #include "CodePageEncoder.hpp"
 #include "Utf8Decoder.hpp"
@@ -21,6 +25,16 @@ namespace Yconvert
 {
     namespace
     {
+        template <typename T, typename... Args>
+        Decoder* construct_decoder(void* memory, size_t memory_size,
+                                   Args&&... args)
+        {
+            static_assert(alignof(T) <= alignof(std::max_align_t));
+            if (sizeof(T) > memory_size)
+                YCONVERT_THROW("Insufficient memory for decoder.");
+            return new(memory) T(std::forward<Args>(args)...);
+        }
+
     #ifdef YCONVERT_ENABLE_CODE_PAGES
 
         constexpr CodePageRange ASCII_CHARS = {0x0000, 0, 127};
@@ -36,15 +50,15 @@ namespace Yconvert
             #endif
             #ifdef YCONVERT_MAC_CODE_PAGES
             if ((unsigned(encoding) & unsigned(Encoding::MAC_CYRILLIC)) != 0)
-                    return get_iso_code_page_ranges(encoding);
+                return get_mac_code_page_ranges(encoding);
             #endif
             #ifdef YCONVERT_DOS_CODE_PAGES
             if ((unsigned(encoding) & unsigned(Encoding::DOS_CP437)) != 0)
-                return get_iso_code_page_ranges(encoding);
+                return get_dos_code_page_ranges(encoding);
             #endif
             #ifdef YCONVERT_WIN_CODE_PAGES
             if ((unsigned(encoding) & unsigned(Encoding::WIN_CP1250)) != 0)
-                return get_iso_code_page_ranges(encoding);
+                return get_win_code_page_ranges(encoding);
             #endif
             return {nullptr, 0};
         }
@@ -60,6 +74,18 @@ namespace Yconvert
             return {};
         }
 
+        Decoder* make_code_page_decoder(Encoding encoding,
+                                        void* memory, size_t memory_size)
+        {
+            auto [ranges, ranges_size] = get_code_page_ranges(encoding);
+            if (ranges)
+            {
+                return construct_decoder<CodePageDecoder>(
+                    memory, memory_size, encoding, ranges, ranges_size);
+            }
+            return nullptr;
+        }
+
         std::unique_ptr<Encoder> make_code_page_encoder(Encoding encoding)
         {
             auto [ranges, ranges_size] = get_code_page_ranges(encoding);
@@ -78,6 +104,11 @@ namespace Yconvert
             return {};
         }
 
+        Decoder* make_code_page_decoder(Encoding, void*, size_t)
+        {
+            return nullptr;
+        }
+
         std::unique_ptr<Encoder> make_code_page_encoder(Encoding)
         {
             return {};
@@ -110,6 +141,41 @@ namespace Yconvert
         YCONVERT_THROW("Unsupported decoder: " + std::string(info.name));
     }
 
+    // DecoderHolder must be able to hold every decoder the function
+    // below can construct, at the alignment construct_decoder expects.
+    static_assert(Details::DecoderHolder::STORAGE_SIZE
+                  % alignof(std::max_align_t) == 0);
+    static_assert(sizeof(Utf8Decoder) <= Details::DecoderHolder::STORAGE_SIZE);
+    static_assert(sizeof(Utf16BEDecoder) <= Details::DecoderHolder::STORAGE_SIZE);
+    static_assert(sizeof(Utf16LEDecoder) <= Details::DecoderHolder::STORAGE_SIZE);
+    static_assert(sizeof(Utf32BEDecoder) <= Details::DecoderHolder::STORAGE_SIZE);
+    static_assert(sizeof(Utf32LEDecoder) <= Details::DecoderHolder::STORAGE_SIZE);
+    static_assert(sizeof(CodePageDecoder) <= Details::DecoderHolder::STORAGE_SIZE);
+
+    Decoder* make_decoder(Encoding encoding, void* memory, size_t memory_size)
+    {
+        switch (encoding)
+        {
+        case Encoding::UTF_8:
+            return construct_decoder<Utf8Decoder>(memory, memory_size);
+        case Encoding::UTF_16_BE:
+            return construct_decoder<Utf16BEDecoder>(memory, memory_size);
+        case Encoding::UTF_16_LE:
+            return construct_decoder<Utf16LEDecoder>(memory, memory_size);
+        case Encoding::UTF_32_BE:
+            return construct_decoder<Utf32BEDecoder>(memory, memory_size);
+        case Encoding::UTF_32_LE:
+            return construct_decoder<Utf32LEDecoder>(memory, memory_size);
+        default:
+            if (auto decoder = make_code_page_decoder(encoding, memory, memory_size))
+                return decoder;
+            break;
+        }
+
+        const auto& info = get_info(encoding);
+        YCONVERT_THROW("Unsupported decoder: " + std::string(info.name));
+    }
+
     std::unique_ptr<Encoder> make_encoder(Encoding encoding)
     {
         switch (encoding)
@@ -15,5 +15,15 @@ namespace Yconvert
 {
     std::unique_ptr<Decoder> make_decoder(Encoding encoding);
 
+    /**
+     * @brief Constructs the decoder for @a encoding in @a memory.
+     *
+     * @a memory must be aligned for std::max_align_t. The caller must
+     * call the decoder's destructor, but not delete it.
+     *
+     * @throw YconvertException if @a memory_size is too small.
+     */
+    Decoder* make_decoder(Encoding encoding, void* memory, size_t memory_size);
+
     std::unique_ptr<Encoder> make_encoder(Encoding encoding);
 }
@@ -0,0 +1,161 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/MappedFile.hpp"
+
+#include <tuple>
+#include <utility>
+#include "YconvertThrow.hpp"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Yconvert
+{
+    namespace
+    {
+    #ifdef _WIN32
+
+        std::pair<const char*, size_t> map_file(const std::string& path)
+        {
+            auto file = CreateFileA(path.c_str(), GENERIC_READ,
+                                    FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                    FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+                YCONVERT_THROW("Unable to open file: " + path);
+
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size))
+            {
+                CloseHandle(file);
+                YCONVERT_THROW("Unable to get the size of file: " + path);
+            }
+
+            if (size.QuadPart == 0)
+            {
+                CloseHandle(file);
+                return {nullptr, 0};
+            }
+
+            auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY,
+                                              0, 0, nullptr);
+            CloseHandle(file);
+            if (!mapping)
+                YCONVERT_THROW("Unable to map file: " + path);
+
+            // The view keeps the mapping alive after its handle is closed.
+            auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (!view)
+                YCONVERT_THROW("Unable to map file: " + path);
+
+            return {static_cast<const char*>(view), size_t(size.QuadPart)};
+        }
+
+        void unmap_file(const char* data, size_t)
+        {
+            UnmapViewOfFile(data);
+        }
+
+    #else
+
+        std::pair<const char*, size_t> map_file(const std::string& path)
+        {
+            auto fd = ::open(path.c_str(), O_RDONLY);
+            if (fd == -1)
+                YCONVERT_THROW("Unable to open file: " + path);
+
+            struct stat st = {};
+            if (::fstat(fd, &st) == -1)
+            {
+                ::close(fd);
+                YCONVERT_THROW("Unable to get the size of file: " + path);
+            }
+
+            if (st.st_size == 0)
+            {
+                ::close(fd);
+                return {nullptr, 0};
+            }
+
+            auto size = size_t(st.st_size);
+            auto addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            // The mapping stays valid after the file descriptor is closed.
+            ::close(fd);
+            if (addr == MAP_FAILED)
+                YCONVERT_THROW("Unable to map file: " + path);
+
+            ::madvise(addr, size, MADV_SEQUENTIAL);
+            return {static_cast<const char*>(addr), size};
+        }
+
+        void unmap_file(const char* data, size_t size)
+        {
+            ::munmap(const_cast<char*>(data), size);
+        }
+
+    #endif
+    }
+
+    MappedFile::MappedFile() = default;
+
+    MappedFile::MappedFile(const std::string& path)
+    {
+        std::tie(data_, size_) = map_file(path);
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0))
+    {}
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    const char* MappedFile::data() const
+    {
+        return data_;
+    }
+
+    size_t MappedFile::size() const
+    {
+        return size_;
+    }
+
+    std::span<const char> MappedFile::span() const
+    {
+        return {data_, size_};
+    }
+
+    void MappedFile::close()
+    {
+        if (data_)
+            unmap_file(data_, size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
@@ -0,0 +1,213 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/OffsetMap.hpp"
+
+#include <algorithm>
+#include "YconvertThrow.hpp"
+
+namespace Yconvert
+{
+    void OffsetMap::add(size_t count, uint32_t source_width,
+                        uint32_t destination_width)
+    {
+        if (count == 0)
+            return;
+
+        if (!runs_.empty())
+        {
+            auto& run = runs_.back();
+            if (run.source_width == source_width
+                && run.destination_width == destination_width)
+            {
+                run.count += count;
+                source_size_ += count * source_width;
+                destination_size_ += count * destination_width;
+                return;
+            }
+        }
+
+        runs_.push_back({source_size_, destination_size_, count,
+                         source_width, destination_width});
+        source_size_ += count * source_width;
+        destination_size_ += count * destination_width;
+    }
+
+    void OffsetMap::clear()
+    {
+        runs_.clear();
+        source_size_ = 0;
+        destination_size_ = 0;
+    }
+
+    bool OffsetMap::empty() const
+    {
+        return runs_.empty();
+    }
+
+    size_t OffsetMap::source_size() const
+    {
+        return source_size_;
+    }
+
+    size_t OffsetMap::destination_size() const
+    {
+        return destination_size_;
+    }
+
+    const std::vector<OffsetRun>& OffsetMap::runs() const
+    {
+        return runs_;
+    }
+
+    size_t OffsetMap::to_destination(size_t source_offset) const
+    {
+        if (source_offset >= source_size_)
+            return destination_size_;
+
+        auto& run = runs_[find_run(source_offset)];
+        auto n = (source_offset - run.source_offset) / run.source_width;
+        return run.destination_offset + n * run.destination_width;
+    }
+
+    size_t OffsetMap::to_source(size_t destination_offset) const
+    {
+        if (destination_offset >= destination_size_)
+            return source_size_;
+
+        // Runs of skipped bytes have the same destination offset as the
+        // run that follows them, upper_bound moves past them.
+        auto it = std::upper_bound(
+            runs_.begin(), runs_.end(), destination_offset,
+            [](size_t offset, const OffsetRun& run)
+            {
+                return offset < run.destination_offset;
+            });
+        auto& run = *(it - 1);
+        auto n = (destination_offset - run.destination_offset)
+                 / run.destination_width;
+        return run.source_offset + n * run.source_width;
+    }
+
+    size_t OffsetMap::floor_source_offset(size_t source_offset) const
+    {
+        if (source_offset >= source_size_)
+            return source_size_;
+
+        auto& run = runs_[find_run(source_offset)];
+        auto n = (source_offset - run.source_offset) / run.source_width;
+        return run.source_offset + n * run.source_width;
+    }
+
+    size_t OffsetMap::ceil_source_offset(size_t source_offset) const
+    {
+        if (source_offset >= source_size_)
+            return source_size_;
+
+        auto& run = runs_[find_run(source_offset)];
+        auto n = (source_offset - run.source_offset + run.source_width - 1)
+                 / run.source_width;
+        return run.source_offset + n * run.source_width;
+    }
+
+    void OffsetMap::replace(size_t source_offset, size_t source_size,
+                            const OffsetMap& map)
+    {
+        if (source_offset > source_size_
+            || source_size > source_size_ - source_offset)
+        {
+            YCONVERT_THROW("The range is outside the offset map.");
+        }
+
+        auto first = split_run(source_offset);
+        auto last = split_run(source_offset + source_size);
+        auto dst_offset = first == runs_.size()
+                          ? destination_size_
+                          : runs_[first].destination_offset;
+        auto dst_end = last == runs_.size()
+                       ? destination_size_
+                       : runs_[last].destination_offset;
+
+        // The differences may be "negative", unsigned arithmetic wraps
+        // around and gives the right result.
+        auto src_delta = map.source_size_ - source_size;
+        auto dst_delta = map.destination_size_ - (dst_end - dst_offset);
+        for (auto i = last; i < runs_.size(); ++i)
+        {
+            runs_[i].source_offset += src_delta;
+            runs_[i].destination_offset += dst_delta;
+        }
+
+        auto it = runs_.erase(runs_.begin() + ptrdiff_t(first),
+                              runs_.begin() + ptrdiff_t(last));
+        it = runs_.insert(it, map.runs_.begin(), map.runs_.end());
+        for (size_t i = 0; i < map.runs_.size(); ++i, ++it)
+        {
+            it->source_offset += source_offset;
+            it->destination_offset += dst_offset;
+        }
+
+        source_size_ += src_delta;
+        destination_size_ += dst_delta;
+
+        // Merge the last run first, merging the first run would move it.
+        merge_runs(first + map.runs_.size());
+        merge_runs(first);
+    }
+
+    size_t OffsetMap::find_run(size_t source_offset) const
+    {
+        // Source widths are never 0, i.e. the source offsets of the runs
+        // are strictly increasing.
+        auto it = std::upper_bound(
+            runs_.begin(), runs_.end(), source_offset,
+            [](size_t offset, const OffsetRun& run)
+            {
+                return offset < run.source_offset;
+            });
+        return size_t(it - runs_.begin()) - 1;
+    }
+
+    size_t OffsetMap::split_run(size_t source_offset)
+    {
+        if (source_offset >= source_size_)
+            return runs_.size();
+
+        auto index = find_run(source_offset);
+        auto& run = runs_[index];
+        if (run.source_offset == source_offset)
+            return index;
+
+        auto n = (source_offset - run.source_offset) / run.source_width;
+        if (run.source_offset + n * run.source_width != source_offset)
+            YCONVERT_THROW("The offset isn't at the start of a code point.");
+
+        OffsetRun tail = {source_offset,
+                          run.destination_offset + n * run.destination_width,
+                          run.count - n,
+                          run.source_width,
+                          run.destination_width};
+        run.count = n;
+        runs_.insert(runs_.begin() + ptrdiff_t(index + 1), tail);
+        return index + 1;
+    }
+
+    void OffsetMap::merge_runs(size_t index)
+    {
+        if (index == 0 || index >= runs_.size())
+            return;
+
+        auto& prev = runs_[index - 1];
+        auto& run = runs_[index];
+        if (prev.source_width == run.source_width
+            && prev.destination_width == run.destination_width)
+        {
+            prev.count += run.count;
+            runs_.erase(runs_.begin() + ptrdiff_t(index));
+        }
+    }
+}
@@ -0,0 +1,68 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "ReplayStreamBuf.hpp"
+
+#include <algorithm>
+
+namespace Yconvert::Detail
+{
+    namespace
+    {
+        /**
+         * @brief The minimum size of the buffer that single characters
+         *  are read through once the prefix has been consumed.
+         */
+        constexpr size_t MIN_BUFFER_SIZE = 4096;
+    }
+
+    ReplayStreamBuf::ReplayStreamBuf(std::streambuf* source,
+                                     std::vector<char> prefix,
+                                     size_t offset)
+        : source_(source),
+          buffer_(std::move(prefix))
+    {
+        auto data = buffer_.data();
+        offset = std::min(offset, buffer_.size());
+        setg(data, data + offset, data + buffer_.size());
+    }
+
+    ReplayStreamBuf::int_type ReplayStreamBuf::underflow()
+    {
+        if (gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
+        if (!source_)
+            return traits_type::eof();
+
+        if (buffer_.size() < MIN_BUFFER_SIZE)
+            buffer_.resize(MIN_BUFFER_SIZE);
+        auto data = buffer_.data();
+        auto n = source_->sgetn(data, std::streamsize(buffer_.size()));
+        setg(data, data, data + std::max<std::streamsize>(n, 0));
+        if (n <= 0)
+            return traits_type::eof();
+        return traits_type::to_int_type(*data);
+    }
+
+    std::streamsize ReplayStreamBuf::xsgetn(char_type* s, std::streamsize n)
+    {
+        auto available = std::min<std::streamsize>(egptr() - gptr(), n);
+        std::copy_n(gptr(), available, s);
+        gbump(int(available));
+        if (available == n || !source_)
+            return available;
+        auto m = source_->sgetn(s + available, n - available);
+        return available + std::max<std::streamsize>(m, 0);
+    }
+
+    std::streamsize ReplayStreamBuf::showmanyc()
+    {
+        if (gptr() < egptr())
+            return egptr() - gptr();
+        return source_ ? source_->in_avail() : -1;
+    }
+}
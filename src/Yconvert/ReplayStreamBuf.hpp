@@ -0,0 +1,44 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <streambuf>
+#include <vector>
+
+namespace Yconvert::Detail
+{
+    /**
+     * @brief A read-only streambuf that returns a buffered prefix
+     *  followed by the contents of another streambuf.
+     *
+     * Once the prefix has been consumed, large reads are passed straight
+     * through to the source, while single characters are read through
+     * the prefix buffer.
+     */
+    class ReplayStreamBuf : public std::streambuf
+    {
+    public:
+        /**
+         * @brief Returns the bytes in @a prefix from @a offset, then the
+         *  contents of @a source.
+         *
+         * @a source can be nullptr if there is nothing more to read.
+         */
+        ReplayStreamBuf(std::streambuf* source,
+                        std::vector<char> prefix,
+                        size_t offset);
+    protected:
+        int_type underflow() override;
+
+        std::streamsize xsgetn(char_type* s, std::streamsize n) override;
+
+        std::streamsize showmanyc() override;
+    private:
+        std::streambuf* source_;
+        std::vector<char> buffer_;
+    };
+}
@@ -0,0 +1,19 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+// YCONVERT_SSE2 is defined if the vectorized code paths can use SSE2
+// intrinsics. SSE2 is part of the x86-64 baseline, other targets use the
+// portable code paths, which process the same blocks one word at a time.
+// Build with -DYCONVERT_SIMD=OFF to force the portable code paths.
+#if !defined(YCONVERT_NO_SIMD) \
+    && (defined(__SSE2__) || defined(_M_X64) \
+        || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define YCONVERT_SSE2
+    #include <emmintrin.h>
+#endif
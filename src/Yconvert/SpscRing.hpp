@@ -0,0 +1,105 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace Yconvert
+{
+    /**
+     * @brief A bounded, lock-free ring of slots shared by exactly one
+     *  producer thread and one consumer thread.
+     *
+     * The producer fills a slot it gets from acquire_for_writing() and
+     * hands it over with commit_write(), the consumer gets it from
+     * acquire_for_reading() and returns it with commit_read(). A thread
+     * that finds the ring full (or empty) blocks until the other thread
+     * makes progress, which provides back-pressure in both directions.
+     *
+     * Either side can close the ring. When the producer closes it, the
+     * consumer still receives the slots that were committed before.
+     * When the consumer closes it, the producer's next acquire fails
+     * immediately.
+     */
+    template <typename T>
+    class SpscRing
+    {
+    public:
+        explicit SpscRing(size_t size, const T& value = T())
+            : slots_(size, value)
+        {}
+
+        /**
+         * @brief Returns the next free slot, or nullptr if the consumer
+         *  has closed the ring.
+         */
+        T* acquire_for_writing()
+        {
+            auto head = head_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto tail = tail_.load(std::memory_order_acquire);
+                if (tail & CLOSED)
+                    return nullptr;
+                if (head - tail < slots_.size())
+                    return &slots_[head % slots_.size()];
+                tail_.wait(tail, std::memory_order_acquire);
+            }
+        }
+
+        void commit_write()
+        {
+            head_.fetch_add(1, std::memory_order_release);
+            head_.notify_one();
+        }
+
+        void close_for_writing()
+        {
+            head_.fetch_or(CLOSED, std::memory_order_release);
+            head_.notify_one();
+        }
+
+        /**
+         * @brief Returns the next filled slot, or nullptr if the ring is
+         *  empty and the producer has closed it.
+         */
+        T* acquire_for_reading()
+        {
+            auto tail = tail_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto head = head_.load(std::memory_order_acquire);
+                if ((head & ~CLOSED) != tail)
+                    return &slots_[tail % slots_.size()];
+                if (head & CLOSED)
+                    return nullptr;
+                head_.wait(head, std::memory_order_acquire);
+            }
+        }
+
+        void commit_read()
+        {
+            tail_.fetch_add(1, std::memory_order_release);
+            tail_.notify_one();
+        }
+
+        void close_for_reading()
+        {
+            tail_.fetch_or(CLOSED, std::memory_order_release);
+            tail_.notify_one();
+        }
+    private:
+        static constexpr size_t CLOSED = ~(~size_t(0) >> 1u);
+
+        std::vector<T> slots_;
+        alignas(64) std::atomic<size_t> head_ = 0;
+        alignas(64) std::atomic<size_t> tail_ = 0;
+    };
+}
@@ -0,0 +1,504 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Utf16Algorithms.hpp"
+
+#include <bit>
+#include <cstdint>
+#include "CodeUnitAccess.hpp"
+#include "Utf16Decoder.hpp"
+
+namespace Yconvert
+{
+    namespace Detail
+    {
+        namespace
+        {
+            constexpr size_t BLOCK_UNITS = 16;
+            constexpr size_t BLOCK_SIZE = BLOCK_UNITS * 2;
+
+            /**
+             * @brief Returns the code point at @a it and advances @a it
+             *  past it, or returns INVALID_CHAR if the code point is invalid
+             *  or incomplete.
+             */
+            template <bool SWAP_BYTES>
+            char32_t read_utf16_code_point(const char*& it, const char* end)
+            {
+                if (end - it < 2)
+                    return INVALID_CHAR;
+                char32_t w = load_utf16_word<SWAP_BYTES>(it);
+                if ((w & 0xF800u) != 0xD800u)
+                {
+                    it += 2;
+                    return w;
+                }
+
+                if (w >= 0xDC00u || end - it < 4)
+                    return INVALID_CHAR;
+                char32_t w2 = load_utf16_word<SWAP_BYTES>(it + 2);
+                if ((w2 & 0xFC00u) != 0xDC00u)
+                    return INVALID_CHAR;
+                it += 4;
+                return ((w & 0x3FFu) << 10u) + (w2 & 0x3FFu) + 0x10000u;
+            }
+
+            /**
+             * @brief Writes @a c to @a dst as one or two UTF-16 code units
+             *  and advances @a dst past them.
+             *
+             * @returns false if @a c is greater than UNICODE_MAX or there
+             *  isn't enough room left in @a dst.
+             */
+            template <bool SWAP_BYTES>
+            bool write_utf16_code_point(char32_t c, char*& dst,
+                                        const char* dst_end)
+            {
+                if (c <= 0xFFFFu)
+                {
+                    if (dst_end - dst < 2)
+                        return false;
+                    store_utf16_word<SWAP_BYTES>(char16_t(c), dst);
+                    dst += 2;
+                    return true;
+                }
+
+                if (c > UNICODE_MAX || dst_end - dst < 4)
+                    return false;
+                c -= 0x10000u;
+                store_utf16_word<SWAP_BYTES>(char16_t(0xD800u | (c >> 10u)), dst);
+                store_utf16_word<SWAP_BYTES>(char16_t(0xDC00u | (c & 0x3FFu)), dst + 2);
+                dst += 4;
+                return true;
+            }
+
+            /**
+             * @brief Bit masks where bit n is set if code unit n in a block
+             *  has the corresponding property.
+             */
+            struct Utf16BlockMasks
+            {
+                uint32_t zero;
+                uint32_t high;
+                uint32_t low;
+                uint32_t below_80;
+                uint32_t below_800;
+            };
+
+        #ifdef YCONVERT_SSE2
+
+            /**
+             * @brief Returns true if none of the code units in @a v are
+             *  surrogates.
+             */
+            bool has_no_surrogates(__m128i v)
+            {
+                const auto mask = _mm_set1_epi16(short(0xF800));
+                const auto surrogate = _mm_set1_epi16(short(0xD800));
+                auto s = _mm_cmpeq_epi16(_mm_and_si128(v, mask), surrogate);
+                return _mm_movemask_epi8(s) == 0;
+            }
+
+            /**
+             * @brief Zero-extends the eight code units in @a v to 32 bits
+             *  and writes them to @a dst.
+             *
+             * The byte order of the result is swapped by placing the
+             * byte-swapped code units in the upper half of each 32-bit
+             * value instead of the lower.
+             */
+            template <bool SWAP_BYTES>
+            void store_widened(__m128i v, char* dst)
+            {
+                const auto zero = _mm_setzero_si128();
+                auto out = reinterpret_cast<__m128i*>(dst);
+                if constexpr (SWAP_BYTES)
+                {
+                    v = swap_bytes_epi16(v);
+                    _mm_storeu_si128(out, _mm_unpacklo_epi16(zero, v));
+                    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(zero, v));
+                }
+                else
+                {
+                    _mm_storeu_si128(out, _mm_unpacklo_epi16(v, zero));
+                    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(v, zero));
+                }
+            }
+
+            /**
+             * @brief Returns true if all the values in @a a and @a b are
+             *  less than 0x10000.
+             */
+            bool are_all_bmp(__m128i a, __m128i b)
+            {
+                auto high = _mm_srli_epi32(_mm_or_si128(a, b), 16);
+                auto is_zero = _mm_cmpeq_epi32(high, _mm_setzero_si128());
+                return _mm_movemask_epi8(is_zero) == 0xFFFF;
+            }
+
+            /**
+             * @brief Narrows the eight values in @a a and @a b, which must
+             *  all be less than 0x10000, to 16 bits and writes them to
+             *  @a dst.
+             */
+            template <bool SWAP_BYTES>
+            void store_narrowed(__m128i a, __m128i b, char* dst)
+            {
+                // SSE2 only has a signed saturating pack, sign-extend the
+                // lower 16 bits to make it pack them unchanged.
+                a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+                b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+                auto v = _mm_packs_epi32(a, b);
+                if constexpr (SWAP_BYTES)
+                    v = swap_bytes_epi16(v);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+            }
+
+            uint32_t movemask_epi16(__m128i a, __m128i b)
+            {
+                return uint32_t(_mm_movemask_epi8(_mm_packs_epi16(a, b)));
+            }
+
+            template <bool SWAP_BYTES>
+            Utf16BlockMasks classify_utf16_block(const char* src)
+            {
+                auto a = load_utf16<SWAP_BYTES>(src);
+                auto b = load_utf16<SWAP_BYTES>(src + 16);
+                const auto zero = _mm_setzero_si128();
+                const auto mask = _mm_set1_epi16(short(0xFC00));
+                const auto high = _mm_set1_epi16(short(0xD800));
+                const auto low = _mm_set1_epi16(short(0xDC00));
+                const auto mask_80 = _mm_set1_epi16(short(0xFF80));
+                const auto mask_800 = _mm_set1_epi16(short(0xF800));
+                auto a_bits = _mm_and_si128(a, mask);
+                auto b_bits = _mm_and_si128(b, mask);
+                return {
+                    movemask_epi16(_mm_cmpeq_epi16(a, zero),
+                                   _mm_cmpeq_epi16(b, zero)),
+                    movemask_epi16(_mm_cmpeq_epi16(a_bits, high),
+                                   _mm_cmpeq_epi16(b_bits, high)),
+                    movemask_epi16(_mm_cmpeq_epi16(a_bits, low),
+                                   _mm_cmpeq_epi16(b_bits, low)),
+                    movemask_epi16(_mm_cmpeq_epi16(_mm_and_si128(a, mask_80), zero),
+                                   _mm_cmpeq_epi16(_mm_and_si128(b, mask_80), zero)),
+                    movemask_epi16(_mm_cmpeq_epi16(_mm_and_si128(a, mask_800), zero),
+                                   _mm_cmpeq_epi16(_mm_and_si128(b, mask_800), zero))
+                };
+            }
+
+        #else
+
+            template <bool SWAP_BYTES>
+            Utf16BlockMasks classify_utf16_block(const char* src)
+            {
+                Utf16BlockMasks result = {0, 0, 0, 0, 0};
+                for (uint32_t i = 0; i < BLOCK_UNITS; ++i)
+                {
+                    auto w = load_utf16_word<SWAP_BYTES>(src + 2 * i);
+                    result.zero |= uint32_t(w == 0) << i;
+                    result.high |= uint32_t((w & 0xFC00u) == 0xD800u) << i;
+                    result.low |= uint32_t((w & 0xFC00u) == 0xDC00u) << i;
+                    result.below_80 |= uint32_t(w < 0x80u) << i;
+                    result.below_800 |= uint32_t(w < 0x800u) << i;
+                }
+                return result;
+            }
+
+        #endif
+
+            /**
+             * @brief The common implementation of decode_utf16 and
+             *  the UTF-16 to UTF-32 transcoders.
+             */
+            template <bool SWAP_SRC, bool SWAP_DST>
+            std::pair<size_t, size_t>
+            widen_utf16(const char* src, size_t src_size,
+                        char* dst, size_t dst_size)
+            {
+                const auto src_end = src + src_size;
+                const auto dst_end = dst + dst_size;
+                auto it = src;
+                auto out = dst;
+            #ifdef YCONVERT_SSE2
+                while (src_end - it >= 16 && dst_end - out >= 32)
+                {
+                    auto v = load_utf16<SWAP_SRC>(it);
+                    if (has_no_surrogates(v))
+                    {
+                        store_widened<SWAP_DST>(v, out);
+                        it += 16;
+                        out += 32;
+                        continue;
+                    }
+
+                    // Decode the block with surrogates one code point at a
+                    // time. There's room for at least eight code points.
+                    const auto block_end = it + 16;
+                    while (it < block_end)
+                    {
+                        auto c = read_utf16_code_point<SWAP_SRC>(it, src_end);
+                        if (c == INVALID_CHAR)
+                            return {size_t(it - src), size_t(out - dst)};
+                        store_utf32_word<SWAP_DST>(c, out);
+                        out += 4;
+                    }
+                }
+            #endif
+                while (dst_end - out >= 4)
+                {
+                    auto c = read_utf16_code_point<SWAP_SRC>(it, src_end);
+                    if (c == INVALID_CHAR)
+                        break;
+                    store_utf32_word<SWAP_DST>(c, out);
+                    out += 4;
+                }
+                return {size_t(it - src), size_t(out - dst)};
+            }
+
+            /**
+             * @brief The common implementation of the UTF-32 to UTF-16
+             *  transcoders.
+             */
+            template <bool SWAP_SRC, bool SWAP_DST>
+            std::pair<size_t, size_t>
+            narrow_utf32(const char* src, size_t src_size,
+                         char* dst, size_t dst_size)
+            {
+                const auto src_end = src + src_size;
+                const auto dst_end = dst + dst_size;
+                auto it = src;
+                auto out = dst;
+            #ifdef YCONVERT_SSE2
+                while (src_end - it >= 32 && dst_end - out >= 16)
+                {
+                    auto a = load_utf32<SWAP_SRC>(it);
+                    auto b = load_utf32<SWAP_SRC>(it + 16);
+                    if (are_all_bmp(a, b))
+                    {
+                        store_narrowed<SWAP_DST>(a, b, out);
+                        it += 32;
+                        out += 16;
+                        continue;
+                    }
+
+                    // Encode the block with surrogate pairs one code point
+                    // at a time.
+                    const auto block_end = it + 32;
+                    while (it < block_end)
+                    {
+                        auto c = load_utf32_word<SWAP_SRC>(it);
+                        if (!write_utf16_code_point<SWAP_DST>(c, out, dst_end))
+                            return {size_t(it - src), size_t(out - dst)};
+                        it += 4;
+                    }
+                }
+            #endif
+                while (src_end - it >= 4)
+                {
+                    auto c = load_utf32_word<SWAP_SRC>(it);
+                    if (!write_utf16_code_point<SWAP_DST>(c, out, dst_end))
+                        break;
+                    it += 4;
+                }
+                return {size_t(it - src), size_t(out - dst)};
+            }
+        }
+
+        template <bool SWAP_BYTES>
+        std::pair<size_t, size_t>
+        count_valid_utf16(const void* src, size_t src_size)
+        {
+            const auto c_src = static_cast<const char*>(src);
+            const auto src_end = c_src + src_size;
+            auto it = c_src;
+            size_t count = 0;
+            // Set if the last unit in the previous block was a high surrogate.
+            uint32_t carry = 0;
+            while (size_t(src_end - it) >= BLOCK_SIZE)
+            {
+                auto masks = classify_utf16_block<SWAP_BYTES>(it);
+                // The low surrogates must be exactly the units that follow
+                // high surrogates.
+                auto expected_low = ((masks.high << 1u) | carry) & 0xFFFFu;
+                if (masks.zero != 0 || masks.low != expected_low)
+                    break;
+                count += BLOCK_UNITS - size_t(std::popcount(masks.low));
+                carry = masks.high >> 15u;
+                it += BLOCK_SIZE;
+            }
+
+            // Let the scalar code deal with a surrogate pair that straddles
+            // the end of the last valid block.
+            if (carry)
+            {
+                it -= 2;
+                --count;
+            }
+
+            while (true)
+            {
+                const auto prev = it;
+                auto value = next_utf16_code_point<SWAP_BYTES>(it, src_end);
+                if (value == INVALID_CHAR || value == 0)
+                    return {count, size_t(prev - c_src)};
+                ++count;
+            }
+        }
+
+        template <bool SWAP_BYTES>
+        Utf16Counts count_utf16(const void* src, size_t src_size)
+        {
+            const auto c_src = static_cast<const char*>(src);
+            const auto src_end = c_src + src_size;
+            auto it = c_src;
+            // Every code unit is counted as three UTF-8 bytes, minus one
+            // for each code unit below 0x800 and each surrogate, and minus
+            // one more for each code unit below 0x80.
+            size_t units = 0;
+            size_t low_surrogates = 0;
+            size_t short_units = 0;
+            uint32_t carry = 0;
+            while (size_t(src_end - it) >= BLOCK_SIZE)
+            {
+                auto masks = classify_utf16_block<SWAP_BYTES>(it);
+                auto expected_low = ((masks.high << 1u) | carry) & 0xFFFFu;
+                if (masks.low != expected_low)
+                    break;
+                units += BLOCK_UNITS;
+                low_surrogates += size_t(std::popcount(masks.low));
+                short_units += size_t(std::popcount(masks.below_80))
+                               + size_t(std::popcount(masks.below_800))
+                               + size_t(std::popcount(masks.high | masks.low));
+                carry = masks.high >> 15u;
+                it += BLOCK_SIZE;
+            }
+
+            if (carry)
+            {
+                it -= 2;
+                --units;
+                --short_units;
+            }
+
+            Utf16Counts counts;
+            counts.bytes = units * 2;
+            counts.code_points = units - low_surrogates;
+            counts.utf8_bytes = 3 * units - short_units;
+            while (true)
+            {
+                const auto prev = it;
+                auto c = read_utf16_code_point<SWAP_BYTES>(it, src_end);
+                if (c == INVALID_CHAR)
+                    return counts;
+                counts.bytes += size_t(it - prev);
+                ++counts.code_points;
+                counts.utf8_bytes += c < 0x80u ? 1 : c < 0x800u ? 2 : c < 0x10000u ? 3 : 4;
+            }
+        }
+
+        template <bool SWAP_BYTES>
+        size_t skip_utf16_code_points(const void* src, size_t src_size, size_t n)
+        {
+            const auto c_src = static_cast<const char*>(src);
+            const auto src_end = c_src + src_size;
+            auto it = c_src;
+            while (size_t(src_end - it) >= BLOCK_SIZE)
+            {
+                auto masks = classify_utf16_block<SWAP_BYTES>(it);
+                auto leads = BLOCK_UNITS - size_t(std::popcount(masks.low));
+                if (leads > n)
+                    break;
+                n -= leads;
+                it += BLOCK_SIZE;
+            }
+
+            for (; src_end - it >= 2; it += 2)
+            {
+                auto w = load_utf16_word<SWAP_BYTES>(it);
+                if ((w & 0xFC00u) != 0xDC00u)
+                {
+                    if (n == 0)
+                        return size_t(it - c_src);
+                    --n;
+                }
+            }
+            return src_size;
+        }
+
+        template <bool SWAP_BYTES>
+        std::pair<size_t, size_t>
+        decode_utf16(const void* src, size_t src_size,
+                     char32_t* dst, size_t dst_size)
+        {
+            auto [n, m] = widen_utf16<SWAP_BYTES, false>(
+                static_cast<const char*>(src), src_size,
+                reinterpret_cast<char*>(dst), dst_size * 4);
+            return {n, m / 4};
+        }
+
+        template <bool SWAP_SRC, bool SWAP_DST>
+        std::pair<size_t, size_t>
+        transcode_utf16_to_utf32(const void* src, size_t src_size,
+                                 void* dst, size_t dst_size)
+        {
+            return widen_utf16<SWAP_SRC, SWAP_DST>(
+                static_cast<const char*>(src), src_size,
+                static_cast<char*>(dst), dst_size);
+        }
+
+        template <bool SWAP_SRC, bool SWAP_DST>
+        std::pair<size_t, size_t>
+        transcode_utf32_to_utf16(const void* src, size_t src_size,
+                                 void* dst, size_t dst_size)
+        {
+            return narrow_utf32<SWAP_SRC, SWAP_DST>(
+                static_cast<const char*>(src), src_size,
+                static_cast<char*>(dst), dst_size);
+        }
+
+        #define YCONVERT_INSTANTIATE_UTF16_ALGORITHMS(SWAP_SRC, SWAP_DST) \
+            template std::pair<size_t, size_t> \
+            transcode_utf16_to_utf32<SWAP_SRC, SWAP_DST>( \
+                const void*, size_t, void*, size_t); \
+            template std::pair<size_t, size_t> \
+            transcode_utf32_to_utf16<SWAP_SRC, SWAP_DST>( \
+                const void*, size_t, void*, size_t)
+
+        YCONVERT_INSTANTIATE_UTF16_ALGORITHMS(false, false);
+        YCONVERT_INSTANTIATE_UTF16_ALGORITHMS(false, true);
+        YCONVERT_INSTANTIATE_UTF16_ALGORITHMS(true, false);
+        YCONVERT_INSTANTIATE_UTF16_ALGORITHMS(true, true);
+
+        #undef YCONVERT_INSTANTIATE_UTF16_ALGORITHMS
+
+        template std::pair<size_t, size_t>
+        count_valid_utf16<false>(const void* src, size_t src_size);
+
+        template std::pair<size_t, size_t>
+        count_valid_utf16<true>(const void* src, size_t src_size);
+
+        template Utf16Counts
+        count_utf16<false>(const void* src, size_t src_size);
+
+        template Utf16Counts
+        count_utf16<true>(const void* src, size_t src_size);
+
+        template size_t
+        skip_utf16_code_points<false>(const void* src, size_t src_size, size_t n);
+
+        template size_t
+        skip_utf16_code_points<true>(const void* src, size_t src_size, size_t n);
+
+        template std::pair<size_t, size_t>
+        decode_utf16<false>(const void* src, size_t src_size,
+                            char32_t* dst, size_t dst_size);
+
+        template std::pair<size_t, size_t>
+        decode_utf16<true>(const void* src, size_t src_size,
+                           char32_t* dst, size_t dst_size);
+    }
+}
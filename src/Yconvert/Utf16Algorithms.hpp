@@ -0,0 +1,117 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include <utility>
+
+namespace Yconvert
+{
+    namespace Detail
+    {
+        /**
+         * @brief Counts the valid UTF-16 code points at the start of @a src.
+         *
+         * The input is validated 16 code units at a time: high and low
+         * surrogates are classified for the whole block and every high
+         * surrogate must be immediately followed by a low surrogate.
+         * Blocks that contain errors or zeros, and the end of the input,
+         * are handled one code point at a time.
+         *
+         * @returns The number of code points and the number of bytes
+         *  preceding the first invalid code point or zero.
+         */
+        template <bool SWAP_BYTES>
+        std::pair<size_t, size_t>
+        count_valid_utf16(const void* src, size_t src_size);
+
+        /**
+         * @brief The lengths of a sequence of UTF-16 code points.
+         */
+        struct Utf16Counts
+        {
+            /// The number of bytes.
+            size_t bytes = 0;
+            /// The number of code points.
+            size_t code_points = 0;
+            /// The number of bytes required to encode the code points
+            /// as UTF-8.
+            size_t utf8_bytes = 0;
+        };
+
+        /**
+         * @brief Counts the code points at the start of @a src up to the
+         *  first invalid or incomplete one.
+         *
+         * Unlike count_valid_utf16, zeros are counted as regular code
+         * points. The code units are classified 16 at a time and the
+         * lengths are computed from the popcounts of the masks.
+         */
+        template <bool SWAP_BYTES>
+        Utf16Counts count_utf16(const void* src, size_t src_size);
+
+        /**
+         * @brief Returns the offset in bytes of code point number @a n in
+         *  the valid UTF-16 in @a src, or @a src_size if there are fewer
+         *  code points.
+         *
+         * The code points are found by counting the code units that
+         * aren't low surrogates, 16 code units at a time.
+         */
+        template <bool SWAP_BYTES>
+        size_t skip_utf16_code_points(const void* src, size_t src_size, size_t n);
+
+        /**
+         * @brief Decodes UTF-16 from @a src to @a dst until the end of
+         *  either buffer or an invalid or incomplete code point is reached.
+         *
+         * Code units are loaded as whole 16-bit words. Runs of eight code
+         * units without surrogates are widened to char32_t with SSE2,
+         * other code units are decoded one code point at a time.
+         *
+         * @returns The number of bytes read from @a src and the number of
+         *  code points written to @a dst.
+         */
+        template <bool SWAP_BYTES>
+        std::pair<size_t, size_t>
+        decode_utf16(const void* src, size_t src_size,
+                     char32_t* dst, size_t dst_size);
+
+        /**
+         * @brief Converts UTF-16 in @a src directly to UTF-32 in @a dst
+         *  until the end of either buffer or an invalid or incomplete code
+         *  point is reached.
+         *
+         * Runs of eight code units without surrogates are zero-extended
+         * a vector at a time, with the byte order of the source and
+         * destination swapped as part of the widening.
+         *
+         * @returns The number of bytes read from @a src and the number of
+         *  bytes written to @a dst.
+         */
+        template <bool SWAP_SRC, bool SWAP_DST>
+        std::pair<size_t, size_t>
+        transcode_utf16_to_utf32(const void* src, size_t src_size,
+                                 void* dst, size_t dst_size);
+
+        /**
+         * @brief Converts UTF-32 in @a src directly to UTF-16 in @a dst
+         *  until the end of either buffer or a value greater than
+         *  UNICODE_MAX is reached.
+         *
+         * Eight values at a time are narrowed to 16 bits if none of them
+         * require surrogate pairs.
+         *
+         * @returns The number of bytes read from @a src and the number of
+         *  bytes written to @a dst.
+         */
+        template <bool SWAP_SRC, bool SWAP_DST>
+        std::pair<size_t, size_t>
+        transcode_utf32_to_utf16(const void* src, size_t src_size,
+                                 void* dst, size_t dst_size);
+    }
+}
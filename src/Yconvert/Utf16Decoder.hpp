@@ -7,6 +7,7 @@
 //****************************************************************************
 #pragma once
 #include "Decoder.hpp"
+#include "Utf16Algorithms.hpp"
 
 namespace Yconvert
 {
@@ -95,36 +96,13 @@ namespace Yconvert
         do_decode(const void* src, size_t src_size,
                   char32_t* dst, size_t dst_size) const final
         {
-            auto c_src = static_cast<const char*>(src);
-            const auto initial_src = c_src;
-            const auto initial_dst = dst;
-            const auto src_end = c_src + src_size;
-            const auto dst_end = dst + dst_size;
-            while (dst != dst_end)
-            {
-                auto value = Detail::next_utf16_code_point<SWAP_BYTES>(c_src, src_end);
-                if (value == INVALID_CHAR)
-                    break;
-                *dst++ = value;
-            }
-            return {size_t(c_src - initial_src), size_t(dst - initial_dst)};
+            return Detail::decode_utf16<SWAP_BYTES>(src, src_size, dst, dst_size);
         }
 
         std::pair<size_t, size_t>
         count_valid_codepoints(const void* src, size_t src_size) const override
         {
-            auto c_src = static_cast<const char*>(src);
-            const auto initial_src = c_src;
-            const auto src_end = c_src + src_size;
-            size_t valid_codepoints = 0;
-            while (true)
-            {
-                const auto prev_src = c_src;
-                auto value = Detail::next_utf16_code_point<SWAP_BYTES>(c_src, src_end);
-                if (value == INVALID_CHAR || value == 0)
-                    return {valid_codepoints, size_t(prev_src - initial_src)};
-                ++valid_codepoints;
-            }
+            return Detail::count_valid_utf16<SWAP_BYTES>(src, src_size);
         }
     };
 
@@ -7,6 +7,8 @@
 //****************************************************************************
 #pragma once
 #include "Encoder.hpp"
+#include "Utf16Algorithms.hpp"
+#include "Utf32Algorithms.hpp"
 
 #include <iterator>
 #include <ostream>
@@ -77,15 +79,7 @@ namespace Yconvert
 
         size_t get_encoded_size(const char32_t* src, size_t src_size) override
         {
-            size_t result = 0;
-            for (size_t i = 0; i < src_size; ++i)
-            {
-                if (src[i] <= 0xFFFF)
-                    result +=  2;
-                else if (src[i] <= UNICODE_MAX)
-                    result += 4;
-            }
-            return result;
+            return Detail::get_utf16_encoded_size(src, src_size);
         }
 
         std::pair<size_t, size_t>
@@ -93,24 +87,31 @@ namespace Yconvert
                void* dst, size_t dst_size) override
         {
             auto cdst = static_cast<char*>(dst);
+            size_t i = 0;
             size_t bytes_written = 0;
-            for (size_t i = 0; i < src_size; ++i)
+            while (true)
             {
-                auto n = Detail::encode_utf16<SWAP_BYTES>(
-                    src[i], cdst + bytes_written, dst_size - bytes_written);
-                if (n == 0 && src[i] <= UNICODE_MAX)
+                auto [r, w] = Detail::transcode_utf32_to_utf16<false, SWAP_BYTES>(
+                    src + i, (src_size - i) * sizeof(char32_t),
+                    cdst + bytes_written, dst_size - bytes_written);
+                i += r / sizeof(char32_t);
+                bytes_written += w;
+                // Values greater than UNICODE_MAX are skipped, anything
+                // else that stops the transcoder means dst is full.
+                if (i == src_size || src[i] <= UNICODE_MAX)
                     return {i, bytes_written};
-                bytes_written += n;
+                ++i;
             }
-            return {src_size, bytes_written};
         }
 
         void encode(const char32_t* src, size_t src_size,
                     std::string& dst) override
         {
-            auto out = back_inserter(dst);
-            for (size_t i = 0; i < src_size; ++i)
-                Detail::add_utf16_bytes<SWAP_BYTES>(src[i], out);
+            auto offset = dst.size();
+            dst.resize(offset + get_encoded_size(src, src_size));
+            auto n = encode(src, src_size, dst.data() + offset,
+                            dst.size() - offset).second;
+            dst.resize(offset + n);
         }
 
         void encode(const char32_t* src, size_t src_size,
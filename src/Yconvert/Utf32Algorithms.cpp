@@ -0,0 +1,210 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Utf32Algorithms.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include "Yconvert/YconvertDefinitions.hpp"
+#include "CodeUnitAccess.hpp"
+
+namespace Yconvert
+{
+    namespace Detail
+    {
+        namespace
+        {
+            /**
+             * @brief A code point's encoded length changes by @a weight
+             *  if it is greater than @a threshold.
+             */
+            struct LengthStep
+            {
+                char32_t threshold;
+                int32_t weight;
+            };
+
+            /**
+             * @brief Returns the sum of the encoded lengths of the code
+             *  points in @a src, where each code point's length is @a base
+             *  plus the weights of the steps it exceeds.
+             *
+             * With SSE2 each step is a comparison over four code points at
+             * a time whose masks are added up in 32-bit lanes. The lanes
+             * are added to the result before they can overflow.
+             */
+            template <size_t N>
+            size_t sum_encoded_lengths(const char32_t* src, size_t src_size,
+                                       size_t base,
+                                       const std::array<LengthStep, N>& steps)
+            {
+                int64_t result = 0;
+                size_t i = 0;
+            #ifdef YCONVERT_SSE2
+                // SSE2 only has signed comparisons, flipping the sign bit
+                // of both sides makes them behave as unsigned comparisons.
+                const auto sign = _mm_set1_epi32(INT32_MIN);
+                __m128i thresholds[N];
+                __m128i weights[N];
+                for (size_t j = 0; j < N; ++j)
+                {
+                    thresholds[j] = _mm_set1_epi32(
+                        int32_t(steps[j].threshold ^ 0x80000000u));
+                    weights[j] = _mm_set1_epi32(steps[j].weight);
+                }
+
+                constexpr size_t MAX_VECTORS_PER_SUM = 1u << 20u;
+                while (src_size - i >= 4)
+                {
+                    auto acc = _mm_setzero_si128();
+                    auto n = std::min((src_size - i) / 4, MAX_VECTORS_PER_SUM);
+                    for (size_t k = 0; k < n; ++k, i += 4)
+                    {
+                        auto v = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i*>(src + i));
+                        v = _mm_xor_si128(v, sign);
+                        for (size_t j = 0; j < N; ++j)
+                        {
+                            auto mask = _mm_cmpgt_epi32(v, thresholds[j]);
+                            acc = _mm_add_epi32(acc, _mm_and_si128(mask, weights[j]));
+                        }
+                    }
+
+                    alignas(16) int32_t lanes[4];
+                    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+                    result += int64_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+                    result += int64_t(n * 4 * base);
+                }
+            #endif
+                for (; i < src_size; ++i)
+                {
+                    auto length = int64_t(base);
+                    for (const auto& step : steps)
+                    {
+                        if (src[i] > step.threshold)
+                            length += step.weight;
+                    }
+                    result += length;
+                }
+                return size_t(result);
+            }
+
+            // Values greater than UNICODE_MAX exceed all the thresholds,
+            // the last weight cancels the others to give them length 0.
+            constexpr std::array<LengthStep, 4> UTF8_LENGTH_STEPS = {{
+                {0x7F, 1}, {0x7FF, 1}, {0xFFFF, 1}, {UNICODE_MAX, -4}
+            }};
+
+            constexpr std::array<LengthStep, 2> UTF16_LENGTH_STEPS = {{
+                {0xFFFF, 2}, {UNICODE_MAX, -4}
+            }};
+
+            constexpr std::array<LengthStep, 1> UTF32_LENGTH_STEPS = {{
+                {UNICODE_MAX, -4}
+            }};
+
+            constexpr bool is_valid_utf32(char32_t c)
+            {
+                return c <= UNICODE_MAX && (c & 0xFFFFF800u) != 0xD800u;
+            }
+
+        #ifdef YCONVERT_SSE2
+
+            /**
+             * @brief Returns a mask with all bits set in the lanes of @a v
+             *  that are zero, surrogates or greater than UNICODE_MAX.
+             */
+            __m128i get_invalid_utf32_or_zero(__m128i v)
+            {
+                const auto sign = _mm_set1_epi32(INT32_MIN);
+                const auto max = _mm_set1_epi32(int32_t(UNICODE_MAX ^ 0x80000000u));
+                const auto mask = _mm_set1_epi32(int32_t(0xFFFFF800u));
+                const auto surrogate = _mm_set1_epi32(0xD800);
+                auto too_large = _mm_cmpgt_epi32(_mm_xor_si128(v, sign), max);
+                auto is_surrogate = _mm_cmpeq_epi32(_mm_and_si128(v, mask), surrogate);
+                auto is_zero = _mm_cmpeq_epi32(v, _mm_setzero_si128());
+                return _mm_or_si128(_mm_or_si128(too_large, is_surrogate), is_zero);
+            }
+
+        #endif
+        }
+
+        size_t get_utf8_encoded_size(const char32_t* src, size_t src_size)
+        {
+            return sum_encoded_lengths(src, src_size, 1, UTF8_LENGTH_STEPS);
+        }
+
+        size_t get_utf16_encoded_size(const char32_t* src, size_t src_size)
+        {
+            return sum_encoded_lengths(src, src_size, 2, UTF16_LENGTH_STEPS);
+        }
+
+        size_t get_utf32_encoded_size(const char32_t* src, size_t src_size)
+        {
+            return sum_encoded_lengths(src, src_size, 4, UTF32_LENGTH_STEPS);
+        }
+
+        template <bool SWAP_BYTES>
+        std::pair<size_t, size_t>
+        count_valid_utf32(const void* src, size_t src_size)
+        {
+            const auto c_src = static_cast<const char*>(src);
+            const auto src_end = c_src + src_size;
+            auto it = c_src;
+        #ifdef YCONVERT_SSE2
+            while (src_end - it >= 32)
+            {
+                auto a = get_invalid_utf32_or_zero(load_utf32<SWAP_BYTES>(it));
+                auto b = get_invalid_utf32_or_zero(load_utf32<SWAP_BYTES>(it + 16));
+                if (_mm_movemask_epi8(_mm_or_si128(a, b)) != 0)
+                    break;
+                it += 32;
+            }
+        #endif
+            while (src_end - it >= 4)
+            {
+                auto c = load_utf32_word<SWAP_BYTES>(it);
+                if (c == 0 || !is_valid_utf32(c))
+                    break;
+                it += 4;
+            }
+            auto bytes = size_t(it - c_src);
+            return {bytes / 4, bytes};
+        }
+
+        size_t find_utf32_value(const char32_t* src, size_t src_size,
+                                char32_t value)
+        {
+            size_t i = 0;
+        #ifdef YCONVERT_SSE2
+            const auto needle = _mm_set1_epi32(int32_t(value));
+            for (; src_size - i >= 8; i += 8)
+            {
+                auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4));
+                auto eq = _mm_or_si128(_mm_cmpeq_epi32(a, needle),
+                                       _mm_cmpeq_epi32(b, needle));
+                if (_mm_movemask_epi8(eq) != 0)
+                    break;
+            }
+        #endif
+            for (; i < src_size; ++i)
+            {
+                if (src[i] == value)
+                    break;
+            }
+            return i;
+        }
+
+        template std::pair<size_t, size_t>
+        count_valid_utf32<false>(const void* src, size_t src_size);
+
+        template std::pair<size_t, size_t>
+        count_valid_utf32<true>(const void* src, size_t src_size);
+    }
+}
@@ -0,0 +1,65 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include <utility>
+
+namespace Yconvert
+{
+    namespace Detail
+    {
+        /**
+         * @brief Returns the number of bytes required to encode the code
+         *  points in @a src as UTF-8.
+         *
+         * Values greater than UNICODE_MAX are not counted, matching
+         * Utf8Encoder.
+         */
+        size_t get_utf8_encoded_size(const char32_t* src, size_t src_size);
+
+        /**
+         * @brief Returns the number of bytes required to encode the code
+         *  points in @a src as UTF-16.
+         *
+         * Values greater than UNICODE_MAX are not counted, matching
+         * Utf16Encoder.
+         */
+        size_t get_utf16_encoded_size(const char32_t* src, size_t src_size);
+
+        /**
+         * @brief Returns the number of bytes required to encode the code
+         *  points in @a src as UTF-32.
+         *
+         * Values greater than UNICODE_MAX are not counted, matching
+         * Utf32Encoder.
+         */
+        size_t get_utf32_encoded_size(const char32_t* src, size_t src_size);
+
+        /**
+         * @brief Counts the valid UTF-32 code points at the start of @a src.
+         *
+         * Values greater than UNICODE_MAX and surrogates are invalid.
+         * The values are range-checked eight at a time. The block that
+         * contains the first invalid value or zero, and the end of the
+         * input, are checked one value at a time.
+         *
+         * @returns The number of code points and the number of bytes
+         *  preceding the first invalid or incomplete code point or zero.
+         */
+        template <bool SWAP_BYTES>
+        std::pair<size_t, size_t>
+        count_valid_utf32(const void* src, size_t src_size);
+
+        /**
+         * @brief Returns the index of the first occurrence of @a value in
+         *  @a src, or @a src_size if there is none.
+         */
+        size_t find_utf32_value(const char32_t* src, size_t src_size,
+                                char32_t value);
+    }
+}
@@ -7,6 +7,7 @@
 //****************************************************************************
 #pragma once
 #include "Decoder.hpp"
+#include "Utf32Algorithms.hpp"
 
 namespace Yconvert
 {
@@ -90,18 +91,7 @@ namespace Yconvert
         std::pair<size_t, size_t>
         count_valid_codepoints(const void* src, size_t src_size) const override
         {
-            auto c_src = static_cast<const char*>(src);
-            auto initial_src = c_src;
-            auto src_end = c_src + src_size;
-            size_t valid_codepoints = 0;
-            while (true)
-            {
-                auto prev_src = c_src;
-                auto value = Detail::next_utf32_code_point<SWAP_BYTES>(c_src, src_end);
-                if (value == INVALID_CHAR || value == 0)
-                    return {valid_codepoints, size_t(prev_src - initial_src)};
-                ++valid_codepoints;
-            }
+            return Detail::count_valid_utf32<SWAP_BYTES>(src, src_size);
         }
     };
 
@@ -7,6 +7,7 @@
 //****************************************************************************
 #pragma once
 #include "Encoder.hpp"
+#include "Utf32Algorithms.hpp"
 
 #include <iterator>
 #include <ostream>
@@ -38,13 +39,7 @@ namespace Yconvert
 
         size_t get_encoded_size(const char32_t* src, size_t src_size) override
         {
-            size_t result = 0;
-            for (size_t i = 0; i < src_size; ++i)
-            {
-                if (src[i] <= UNICODE_MAX)
-                    result += 4;
-            }
-            return result;
+            return Detail::get_utf32_encoded_size(src, src_size);
         }
 
         std::pair<size_t, size_t>
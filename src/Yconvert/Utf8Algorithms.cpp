@@ -0,0 +1,300 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Utf8Algorithms.hpp"
+
+#include <bit>
+#include <cstdint>
+#include "SimdDefinitions.hpp"
+#include "Utf8Decoder.hpp"
+
+namespace Yconvert
+{
+    namespace Detail
+    {
+        namespace
+        {
+            constexpr size_t BLOCK_SIZE = 16;
+
+            /**
+             * @brief Bit masks where bit n is set if byte n in a block
+             *  has the corresponding property.
+             */
+            struct Utf8BlockMasks
+            {
+                uint32_t non_ascii;
+                uint32_t continuation;
+                uint32_t lead2;
+                uint32_t lead3;
+                uint32_t lead4;
+                /// Bytes from 0xF4 and up, and 0xF0 followed by a byte
+                /// less than 0x90. They may be invalid or give code points
+                /// that aren't supplementary. When counting well-formed
+                /// UTF-8, also overlong sequences and surrogates.
+                uint32_t rare;
+            };
+
+        #ifdef YCONVERT_SSE2
+
+            uint32_t movemask(__m128i v)
+            {
+                return uint32_t(_mm_movemask_epi8(v));
+            }
+
+            uint32_t match_bits(__m128i v, uint8_t mask, uint8_t bits)
+            {
+                auto masked = _mm_and_si128(v, _mm_set1_epi8(char(mask)));
+                return movemask(_mm_cmpeq_epi8(masked, _mm_set1_epi8(char(bits))));
+            }
+
+            template <bool WellFormed>
+            Utf8BlockMasks classify_utf8_block(const char* src)
+            {
+                auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+                Utf8BlockMasks result = {};
+                result.non_ascii = movemask(v);
+                if (result.non_ascii == 0)
+                    return result;
+                result.continuation = match_bits(v, 0xC0, 0x80);
+                result.lead2 = match_bits(v, 0xE0, 0xC0);
+                result.lead3 = match_bits(v, 0xF0, 0xE0);
+                result.lead4 = match_bits(v, 0xF8, 0xF0);
+                auto f4 = _mm_set1_epi8(char(0xF4));
+                auto f0 = movemask(_mm_cmpeq_epi8(v, _mm_set1_epi8(char(0xF0))));
+                result.rare = movemask(_mm_cmpeq_epi8(_mm_max_epu8(v, f4), v))
+                              | ((f0 << 1u) & match_bits(v, 0xF0, 0x80));
+                if constexpr (WellFormed)
+                {
+                    // 0xC0 and 0xC1, 0xE0 followed by 0x80-0x9F and 0xED
+                    // followed by 0xA0-0xBF.
+                    auto e0 = movemask(_mm_cmpeq_epi8(v, _mm_set1_epi8(char(0xE0))));
+                    auto ed = movemask(_mm_cmpeq_epi8(v, _mm_set1_epi8(char(0xED))));
+                    result.rare |= match_bits(v, 0xFE, 0xC0)
+                                   | ((e0 << 1u) & match_bits(v, 0xE0, 0x80))
+                                   | ((ed << 1u) & match_bits(v, 0xE0, 0xA0));
+                }
+                return result;
+            }
+
+        #else
+
+            template <bool WellFormed>
+            Utf8BlockMasks classify_utf8_block(const char* src)
+            {
+                Utf8BlockMasks result = {};
+                uint32_t f0 = 0;
+                uint32_t low_continuation = 0;
+                uint32_t e0 = 0;
+                uint32_t ed = 0;
+                uint32_t high_continuation = 0;
+                for (uint32_t i = 0; i < BLOCK_SIZE; ++i)
+                {
+                    auto b = uint8_t(src[i]);
+                    result.non_ascii |= uint32_t(b >= 0x80) << i;
+                    result.continuation |= uint32_t((b & 0xC0u) == 0x80) << i;
+                    result.lead2 |= uint32_t((b & 0xE0u) == 0xC0) << i;
+                    result.lead3 |= uint32_t((b & 0xF0u) == 0xE0) << i;
+                    result.lead4 |= uint32_t((b & 0xF8u) == 0xF0) << i;
+                    result.rare |= uint32_t(b >= 0xF4) << i;
+                    f0 |= uint32_t(b == 0xF0) << i;
+                    low_continuation |= uint32_t((b & 0xF0u) == 0x80) << i;
+                    if constexpr (WellFormed)
+                    {
+                        result.rare |= uint32_t((b & 0xFEu) == 0xC0) << i;
+                        e0 |= uint32_t(b == 0xE0) << i;
+                        ed |= uint32_t(b == 0xED) << i;
+                        high_continuation |= uint32_t((b & 0xE0u) == 0xA0) << i;
+                    }
+                }
+                result.rare |= (f0 << 1u) & low_continuation;
+                if constexpr (WellFormed)
+                {
+                    // 0xE0 followed by 0x80-0x9F and 0xED followed by
+                    // 0xA0-0xBF.
+                    auto mid_continuation = result.continuation & ~high_continuation;
+                    result.rare |= ((e0 << 1u) & mid_continuation)
+                                   | ((ed << 1u) & high_continuation);
+                }
+                return result;
+            }
+
+        #endif
+
+            /**
+             * @brief Returns the bit mask of the continuation bytes required
+             *  by the lead bytes in @a lead2, @a lead3 and @a lead4.
+             */
+            uint32_t get_expected_continuation(uint32_t lead2, uint32_t lead3,
+                                               uint32_t lead4)
+            {
+                return (lead2 << 1u)
+                       | (lead3 << 1u) | (lead3 << 2u)
+                       | (lead4 << 1u) | (lead4 << 2u) | (lead4 << 3u);
+            }
+
+            /**
+             * @brief Counts the valid code points in a non-ASCII block.
+             *
+             * @returns The number of bytes that were counted, or 0 if the
+             *  block must be handled one code point at a time. A code point
+             *  that continues into the next block is not counted.
+             */
+            size_t count_utf8_block(const Utf8BlockMasks& masks,
+                                    Utf8Counts& counts)
+            {
+                if (masks.rare)
+                    return 0;
+
+                auto lead2 = masks.lead2;
+                auto lead3 = masks.lead3;
+                auto lead4 = masks.lead4;
+                auto expected = get_expected_continuation(lead2, lead3, lead4);
+                size_t size = BLOCK_SIZE;
+                if (expected >> BLOCK_SIZE)
+                {
+                    // Only the last code point in a valid block can continue
+                    // into the next block, stop in front of it.
+                    auto leads = lead2 | lead3 | lead4;
+                    size = size_t(31 - std::countl_zero(leads));
+                    auto prefix = (1u << size) - 1;
+                    expected = get_expected_continuation(lead2 & prefix,
+                                                         lead3 & prefix,
+                                                         lead4 & prefix);
+                    if (expected >> size)
+                        return 0;
+                    lead4 &= prefix;
+                }
+
+                auto prefix = (1u << size) - 1;
+                if ((masks.continuation ^ expected) & prefix)
+                    return 0;
+
+                counts.bytes += size;
+                counts.code_points += size - size_t(std::popcount(expected));
+                counts.supplementary += size_t(std::popcount(lead4));
+                return size;
+            }
+
+            /**
+             * @brief Returns true if @a value, decoded from a sequence of
+             *  @a length bytes, is neither overlong, a surrogate nor
+             *  greater than UNICODE_MAX.
+             */
+            bool is_well_formed_utf8(char32_t value, size_t length)
+            {
+                constexpr char32_t MIN_VALUES[] = {0, 0, 0x80, 0x800, 0x10000};
+                return value >= MIN_VALUES[length]
+                       && (value < 0xD800 || 0xE000 <= value)
+                       && value <= UNICODE_MAX;
+            }
+
+            /**
+             * @brief Counts the code point at @a it and advances @a it past
+             *  it.
+             *
+             * @returns false if the code point is invalid or incomplete,
+             *  or, if @a WellFormed is true, not well-formed.
+             */
+            template <bool WellFormed>
+            bool count_utf8_code_point(const char*& it, const char* end,
+                                       Utf8Counts& counts)
+            {
+                auto prev = it;
+                auto value = next_utf8_value(it, end);
+                if (value == INVALID_CHAR)
+                    return false;
+                if constexpr (WellFormed)
+                {
+                    if (!is_well_formed_utf8(value, size_t(it - prev)))
+                    {
+                        it = prev;
+                        return false;
+                    }
+                }
+                counts.bytes += size_t(it - prev);
+                ++counts.code_points;
+                if (value > UNICODE_MAX)
+                    ++counts.out_of_range;
+                else if (value >= 0x10000)
+                    ++counts.supplementary;
+                return true;
+            }
+
+            template <bool WellFormed>
+            Utf8Counts count_utf8_impl(const void* src, size_t src_size)
+            {
+                auto it = static_cast<const char*>(src);
+                const auto end = it + src_size;
+                Utf8Counts counts;
+                while (size_t(end - it) >= BLOCK_SIZE)
+                {
+                    auto masks = classify_utf8_block<WellFormed>(it);
+                    if (masks.non_ascii == 0)
+                    {
+                        counts.bytes += BLOCK_SIZE;
+                        counts.code_points += BLOCK_SIZE;
+                        it += BLOCK_SIZE;
+                        continue;
+                    }
+
+                    if (auto n = count_utf8_block(masks, counts))
+                    {
+                        it += n;
+                        continue;
+                    }
+
+                    const auto block_end = it + BLOCK_SIZE;
+                    while (it < block_end)
+                    {
+                        if (!count_utf8_code_point<WellFormed>(it, end, counts))
+                            return counts;
+                    }
+                }
+
+                while (count_utf8_code_point<WellFormed>(it, end, counts))
+                {}
+                return counts;
+            }
+        }
+
+        Utf8Counts count_utf8(const void* src, size_t src_size)
+        {
+            return count_utf8_impl<false>(src, src_size);
+        }
+
+        Utf8Counts count_well_formed_utf8(const void* src, size_t src_size)
+        {
+            return count_utf8_impl<true>(src, src_size);
+        }
+
+        size_t skip_utf8_code_points(const void* src, size_t src_size, size_t n)
+        {
+            auto it = static_cast<const char*>(src);
+            const auto end = it + src_size;
+            while (size_t(end - it) >= BLOCK_SIZE)
+            {
+                auto masks = classify_utf8_block<false>(it);
+                auto leads = BLOCK_SIZE - size_t(std::popcount(masks.continuation));
+                if (leads > n)
+                    break;
+                n -= leads;
+                it += BLOCK_SIZE;
+            }
+
+            for (; it != end; ++it)
+            {
+                if ((uint8_t(*it) & 0xC0u) != 0x80)
+                {
+                    if (n == 0)
+                        break;
+                    --n;
+                }
+            }
+            return size_t(it - static_cast<const char*>(src));
+        }
+    }
+}
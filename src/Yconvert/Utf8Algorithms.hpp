@@ -0,0 +1,84 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+
+namespace Yconvert
+{
+    namespace Detail
+    {
+        /**
+         * @brief The lengths of a sequence of UTF-8 code points.
+         */
+        struct Utf8Counts
+        {
+            /// The number of bytes.
+            size_t bytes = 0;
+            /// The number of code points.
+            size_t code_points = 0;
+            /// The number of code points in the range 0x10000 to UNICODE_MAX.
+            size_t supplementary = 0;
+            /// The number of code points greater than UNICODE_MAX.
+            size_t out_of_range = 0;
+
+            /**
+             * @brief The number of UTF-16 code units required to encode
+             *  the code points.
+             */
+            [[nodiscard]]
+            size_t utf16_units() const
+            {
+                return code_points - out_of_range + supplementary;
+            }
+
+            /**
+             * @brief The number of UTF-32 code units required to encode
+             *  the code points.
+             */
+            [[nodiscard]]
+            size_t utf32_units() const
+            {
+                return code_points - out_of_range;
+            }
+        };
+
+        /**
+         * @brief Counts the code points at the start of @a src that
+         *  Utf8Decoder accepts, up to the first invalid or incomplete one.
+         *
+         * The input is processed 16 bytes at a time. Blocks of ASCII
+         * characters are skipped after a single test, other blocks are
+         * validated by classifying each byte as a lead or continuation
+         * byte and checking that the continuation bytes are exactly those
+         * that the lead bytes call for. The code points are then counted
+         * with popcount. Blocks with errors, unusual four-byte sequences,
+         * and the end of the input, are handled one code point at a time.
+         */
+        Utf8Counts count_utf8(const void* src, size_t src_size);
+
+        /**
+         * @brief Counts the code points at the start of @a src up to the
+         *  first one that isn't well-formed UTF-8.
+         *
+         * Works like count_utf8, but also stops at overlong sequences,
+         * surrogates and code points greater than UNICODE_MAX, which
+         * Utf8Decoder accepts. out_of_range in the result is always 0.
+         */
+        Utf8Counts count_well_formed_utf8(const void* src, size_t src_size);
+
+        /**
+         * @brief Returns the offset of code point number @a n in the
+         *  valid UTF-8 in @a src, or @a src_size if there are fewer code
+         *  points.
+         *
+         * The code points are found by counting the bytes that aren't
+         * continuation bytes, 16 bytes at a time.
+         */
+        size_t skip_utf8_code_points(const void* src, size_t src_size, size_t n);
+    }
+}
@@ -10,6 +10,16 @@
 
 namespace Yconvert
 {
+    namespace Detail
+    {
+        /**
+         * @brief Returns the code point at @a it and advances @a it past
+         *  it, or returns INVALID_CHAR if the code point is invalid
+         *  or incomplete.
+         */
+        char32_t next_utf8_value(const char*& it, const char* end);
+    }
+
     class Utf8Decoder : public Decoder
     {
     public:
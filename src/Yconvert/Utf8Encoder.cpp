@@ -9,6 +9,7 @@
 
 #include <iterator>
 #include <ostream>
+#include "Utf32Algorithms.hpp"
 
 namespace Yconvert
 {
@@ -55,10 +56,7 @@ namespace Yconvert
 
     size_t Utf8Encoder::get_encoded_size(const char32_t* src, size_t src_size)
     {
-        size_t result = 0;
-        for (size_t i = 0; i < src_size; ++i)
-            result += Detail::get_utf8_encoded_length(src[i]);
-        return result;
+        return Detail::get_utf8_encoded_size(src, src_size);
     }
 
     std::pair<size_t, size_t>
@@ -0,0 +1,71 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/ChunkConverter.hpp"
+
+#include <string_view>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "U8Adapter.hpp"
+
+using namespace Yconvert;
+
+TEST_CASE("Convert chunks that split characters")
+{
+    std::string_view text = U8("Blåbærsyltetøy €100 \U0001F600");
+    Converter converter(Encoding::UTF_8, Encoding::UTF_32_LE);
+    auto expected = U"Blåbærsyltetøy €100 \U0001F600";
+    auto expected_bytes = std::string_view(reinterpret_cast<const char*>(expected),
+                                           std::char_traits<char32_t>::length(expected) * 4);
+
+    for (size_t chunk_size = 1; chunk_size <= 5; ++chunk_size)
+    {
+        std::vector<std::string_view> chunks;
+        for (size_t i = 0; i < text.size(); i += chunk_size)
+            chunks.push_back(text.substr(i, chunk_size));
+
+        std::string result;
+        for (auto output : convert_chunks(chunks, converter, 8))
+        {
+            REQUIRE(output.size() <= ChunkConverter::MIN_BUFFER_SIZE);
+            result.append(output.data(), output.size());
+        }
+        REQUIRE(result == expected_bytes);
+    }
+}
+
+TEST_CASE("ChunkConverter carries incomplete characters")
+{
+    Converter converter(Encoding::UTF_8, Encoding::UTF_16_LE);
+    ChunkConverter chunk_converter(converter);
+    std::string result;
+    for (auto output : chunk_converter.convert(std::span<const char>("A\xE2\x82", 3)))
+        result.append(output.data(), output.size());
+    REQUIRE(result == std::string("A\0", 2));
+    REQUIRE(chunk_converter.pending_size() == 2);
+
+    for (auto output : chunk_converter.convert(std::span<const char>("\xAC", 1)))
+        result.append(output.data(), output.size());
+    REQUIRE(chunk_converter.pending_size() == 0);
+
+    for (auto output : chunk_converter.finish())
+        result.append(output.data(), output.size());
+    REQUIRE(result == std::string("A\0\xAC\x20", 4));
+}
+
+TEST_CASE("ChunkConverter finishes with an incomplete character")
+{
+    Converter converter(Encoding::UTF_8, Encoding::UTF_8);
+    converter.set_error_policy(ErrorPolicy::REPLACE);
+    ChunkConverter chunk_converter(converter);
+    std::string result;
+    for (auto output : chunk_converter.convert(std::span<const char>("ab\xF0\x9F", 4)))
+        result.append(output.data(), output.size());
+    for (auto output : chunk_converter.finish())
+        result.append(output.data(), output.size());
+    REQUIRE(result == U8("ab�"));
+}
@@ -0,0 +1,116 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/CodepointCursor.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "Yconvert/YconvertException.hpp"
+
+namespace
+{
+    struct Position
+    {
+        size_t offset;
+        char32_t value;
+
+        bool operator==(const Position&) const = default;
+    };
+
+    std::vector<Position> walk_forward(Yconvert::CodepointCursor cursor)
+    {
+        std::vector<Position> result;
+        cursor.set_offset(0);
+        char32_t c;
+        while (cursor.next(&c))
+            result.push_back({cursor.offset(), c});
+        return result;
+    }
+
+    std::vector<Position> walk_backward(Yconvert::CodepointCursor cursor)
+    {
+        std::vector<Position> result;
+        cursor.set_offset(SIZE_MAX);
+        auto offset = cursor.offset();
+        char32_t c;
+        while (cursor.prev(&c))
+        {
+            result.push_back({offset, c});
+            offset = cursor.offset();
+        }
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    std::u32string values(const std::vector<Position>& positions)
+    {
+        std::u32string result;
+        for (auto& p : positions)
+            result.push_back(p.value);
+        return result;
+    }
+}
+
+TEST_CASE("Move a CodepointCursor through valid UTF-8")
+{
+    std::string_view text = "Aæ€\U0001F600";
+    Yconvert::CodepointCursor cursor(text, Yconvert::Encoding::UTF_8, 3);
+    char32_t c;
+    REQUIRE(cursor.prev(&c));
+    REQUIRE(c == U'æ');
+    REQUIRE(cursor.offset() == 1);
+    REQUIRE(cursor.next(&c));
+    REQUIRE(c == U'æ');
+    REQUIRE(cursor.next(&c));
+    REQUIRE(c == U'€');
+    REQUIRE(cursor.offset() == 6);
+
+    auto forward = walk_forward(cursor);
+    REQUIRE(values(forward) == U"Aæ€\U0001F600");
+    REQUIRE(forward == walk_backward(cursor));
+}
+
+TEST_CASE("Move a CodepointCursor through invalid UTF-8")
+{
+    std::string_view text = "A\xE2\x82" "B\x80\x80\xF0\x9F\x98\x80\xF0\x9F";
+    Yconvert::CodepointCursor cursor(text, Yconvert::Encoding::UTF_8);
+    auto forward = walk_forward(cursor);
+    REQUIRE(values(forward) == U"A��B��\U0001F600��");
+    REQUIRE(forward == walk_backward(cursor));
+}
+
+TEST_CASE("Move a CodepointCursor through UTF-16")
+{
+    std::u16string_view text = u"A\U0001F600\xDC00" u"B\xD800";
+    Yconvert::CodepointCursor cursor(text, Yconvert::Encoding::UTF_16_NATIVE);
+    auto forward = walk_forward(cursor);
+    REQUIRE(values(forward) == U"A\U0001F600�B�");
+    REQUIRE(forward == walk_backward(cursor));
+
+    std::string be("\0A\xD8\x3D\xDE\x00\0", 7);
+    Yconvert::CodepointCursor be_cursor(be.data(), be.size(), Yconvert::Encoding::UTF_16_BE);
+    forward = walk_forward(be_cursor);
+    REQUIRE(values(forward) == U"A\U0001F600�");
+    REQUIRE(forward == walk_backward(be_cursor));
+}
+
+TEST_CASE("Move a CodepointCursor through UTF-32")
+{
+    std::string be("\0\0\0A\0\x01\xF6\x00\0\0", 10);
+    Yconvert::CodepointCursor cursor(be.data(), be.size(), Yconvert::Encoding::UTF_32_BE);
+    auto forward = walk_forward(cursor);
+    REQUIRE(values(forward) == U"A\U0001F600�");
+    REQUIRE(forward == walk_backward(cursor));
+}
+
+TEST_CASE("CodepointCursor with unsupported encoding")
+{
+    REQUIRE_THROWS_AS(Yconvert::CodepointCursor("A", 1, Yconvert::Encoding::ASCII),
+                      Yconvert::YconvertException);
+}
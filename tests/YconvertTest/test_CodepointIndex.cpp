@@ -0,0 +1,203 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/CodepointIndex.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include "Yconvert/Convert.hpp"
+#include "Yconvert/YconvertException.hpp"
+
+namespace
+{
+    std::u32string read_all(Yconvert::CodepointIterator it)
+    {
+        std::u32string result;
+        char32_t c;
+        while (it.next(&c))
+            result.push_back(c);
+        return result;
+    }
+
+    void check_index(const std::string& text, Yconvert::Encoding encoding,
+                     size_t interval,
+                     Yconvert::ErrorPolicy policy = Yconvert::ErrorPolicy::REPLACE)
+    {
+        auto expected = read_all(Yconvert::CodepointIterator(
+            text.data(), text.size(), encoding, policy));
+
+        Yconvert::CodepointIndex index(text.data(), text.size(), encoding,
+                                       interval, policy);
+        REQUIRE(index.size() == expected.size());
+        REQUIRE(index.byte_offset(expected.size()) == text.size());
+        REQUIRE(index.codepoint_index(text.size()) == expected.size());
+
+        size_t prev_offset = 0;
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            auto offset = index.byte_offset(i);
+            REQUIRE(offset >= prev_offset);
+            REQUIRE(index.codepoint_index(offset) == i);
+            if (i % 13 == 0)
+                REQUIRE(read_all(index.seek(i)) == expected.substr(i));
+            prev_offset = offset;
+        }
+    }
+
+    /**
+     * @brief Overwrites the 8-byte little-endian integer at @a offset
+     *  in @a data.
+     */
+    void write_uint64(std::string& data, size_t offset, uint64_t value)
+    {
+        for (size_t i = 0; i < 8; ++i)
+            data[offset + i] = char(uint8_t(value >> (8 * i)));
+    }
+
+    std::string make_text(Yconvert::Encoding encoding)
+    {
+        std::u32string text;
+        for (int i = 0; i < 40; ++i)
+            text += U"Blåbærsyltetøy, € og \U0001F600. ";
+        return Yconvert::convert_to<std::string>(text, Yconvert::Encoding::UTF_32_NATIVE,
+                                                  encoding);
+    }
+}
+
+TEST_CASE("CodepointIndex for UTF-8")
+{
+    auto text = make_text(Yconvert::Encoding::UTF_8);
+    check_index(text, Yconvert::Encoding::UTF_8, 1);
+    check_index(text, Yconvert::Encoding::UTF_8, 7);
+    check_index(text, Yconvert::Encoding::UTF_8, 1000000);
+
+    text[100] = '\x80';
+    text[517] = '\xF0';
+    text.push_back('\xE2');
+    check_index(text, Yconvert::Encoding::UTF_8, 16);
+    check_index(text, Yconvert::Encoding::UTF_8, 16, Yconvert::ErrorPolicy::SKIP);
+}
+
+TEST_CASE("CodepointIndex for UTF-16")
+{
+    for (auto encoding : {Yconvert::Encoding::UTF_16_LE, Yconvert::Encoding::UTF_16_BE})
+    {
+        auto text = make_text(encoding);
+        check_index(text, encoding, 5);
+
+        text[201] = '\xDC';
+        text[200] = '\xDC';
+        text.push_back('A');
+        check_index(text, encoding, 32);
+    }
+}
+
+TEST_CASE("CodepointIndex for other encodings")
+{
+    check_index(make_text(Yconvert::Encoding::UTF_32_BE), Yconvert::Encoding::UTF_32_BE, 9);
+    check_index(make_text(Yconvert::Encoding::ISO_8859_1), Yconvert::Encoding::ISO_8859_1, 9);
+}
+
+TEST_CASE("Serialize CodepointIndex")
+{
+    auto text = make_text(Yconvert::Encoding::UTF_8);
+    Yconvert::CodepointIndex index(text.data(), text.size(), Yconvert::Encoding::UTF_8, 10);
+    auto data = index.serialize();
+
+    auto copy = Yconvert::CodepointIndex::deserialize(data, text.data(), text.size());
+    REQUIRE(copy.size() == index.size());
+    REQUIRE(copy.interval() == 10);
+    REQUIRE(copy.encoding() == Yconvert::Encoding::UTF_8);
+    for (size_t i = 0; i < index.size(); i += 7)
+        REQUIRE(copy.byte_offset(i) == index.byte_offset(i));
+    REQUIRE(copy.serialize() == data);
+
+    REQUIRE_THROWS_AS(Yconvert::CodepointIndex::deserialize(data, text.data(), text.size() - 1),
+                      Yconvert::YconvertException);
+    REQUIRE_THROWS_AS(Yconvert::CodepointIndex::deserialize(data.substr(0, data.size() - 1),
+                                                            text.data(), text.size()),
+                      Yconvert::YconvertException);
+    REQUIRE_THROWS_AS(Yconvert::CodepointIndex::deserialize("garbage", text.data(), text.size()),
+                      Yconvert::YconvertException);
+}
+
+TEST_CASE("Deserialize corrupt CodepointIndex")
+{
+    // Header: magic, version, encoding, error policy and a reserved
+    // field, followed by the interval, buffer size, code point count,
+    // checkpoint count and the checkpoints.
+    constexpr size_t INTERVAL = 24;
+    constexpr size_t COUNT = 40;
+    constexpr size_t CHECKPOINTS = 48;
+    constexpr size_t OFFSETS = 56;
+
+    auto text = make_text(Yconvert::Encoding::UTF_8);
+    Yconvert::CodepointIndex index(text.data(), text.size(), Yconvert::Encoding::UTF_8, 10);
+    auto data = index.serialize();
+    auto checkpoints = (index.size() - 1) / 10 + 1;
+    REQUIRE(data.size() == OFFSETS + checkpoints * 8);
+
+    auto check_corrupt = [&](const std::string& corrupt)
+    {
+        REQUIRE_THROWS_AS(Yconvert::CodepointIndex::deserialize(corrupt, text.data(), text.size()),
+                          Yconvert::YconvertException);
+    };
+
+    SECTION("First offset isn't 0")
+    {
+        auto corrupt = data;
+        write_uint64(corrupt, OFFSETS, 1);
+        check_corrupt(corrupt);
+    }
+
+    SECTION("Offsets don't increase")
+    {
+        auto corrupt = data;
+        write_uint64(corrupt, OFFSETS + 16, 5);
+        check_corrupt(corrupt);
+    }
+
+    SECTION("Offset beyond the buffer")
+    {
+        auto corrupt = data;
+        write_uint64(corrupt, OFFSETS + (checkpoints - 1) * 8, text.size());
+        check_corrupt(corrupt);
+    }
+
+    SECTION("Too few checkpoints")
+    {
+        auto corrupt = data.substr(0, data.size() - 8);
+        write_uint64(corrupt, CHECKPOINTS, checkpoints - 1);
+        check_corrupt(corrupt);
+    }
+
+    SECTION("Too many checkpoints")
+    {
+        auto corrupt = data;
+        write_uint64(corrupt, INTERVAL, 20);
+        check_corrupt(corrupt);
+    }
+
+    SECTION("More code points than bytes")
+    {
+        auto corrupt = data;
+        write_uint64(corrupt, COUNT, text.size() + 1);
+        check_corrupt(corrupt);
+    }
+}
+
+TEST_CASE("Serialize CodepointIndex with ignored bytes at the end")
+{
+    std::string text(20, 'a');
+    text += "\xFF";
+    Yconvert::CodepointIndex index(text.data(), text.size(), Yconvert::Encoding::UTF_8,
+                                   10, Yconvert::ErrorPolicy::IGNORE);
+    REQUIRE(index.size() == 20);
+    auto copy = Yconvert::CodepointIndex::deserialize(index.serialize(),
+                                                      text.data(), text.size());
+    REQUIRE(copy.size() == 20);
+    REQUIRE(copy.byte_offset(15) == 15);
+}
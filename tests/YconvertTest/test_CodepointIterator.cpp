@@ -7,6 +7,7 @@
 //****************************************************************************
 #include "Yconvert/CodepointIterator.hpp"
 
+#include <algorithm>
 #include <sstream>
 #include <vector>
 #include <catch2/catch_test_macros.hpp>
@@ -57,6 +58,26 @@ TEST_CASE("Iterate over a stream")
     REQUIRE(n == 1 << 16);
 }
 
+TEST_CASE("Iterate over a stream with a small stream buffer")
+{
+    std::u32string expected;
+    std::stringstream stream;
+    for (int i = 0; i < 100; ++i)
+    {
+        expected += U"Blåbærsyltetøy \U0001F600 ";
+        stream << "Bl\xC3\xA5""b\xC3\xA6rsyltet\xC3\xB8y \xF0\x9F\x98\x80 ";
+    }
+
+    stream.seekg(0);
+    Yconvert::CodepointIterator iter(stream, Yconvert::Encoding::UTF_8,
+                                     Yconvert::ErrorPolicy::THROW, 256);
+    std::u32string result;
+    char32_t c;
+    while (iter.next(&c))
+        result.push_back(c);
+    REQUIRE(result == expected);
+}
+
 TEST_CASE("Range-based for loop")
 {
     std::vector<char16_t> buffer = {'A', 0xD900, 0xDD00, 'B'};
@@ -70,3 +91,199 @@ TEST_CASE("Range-based for loop")
         expected.remove_prefix(1);
     }
 }
+
+TEST_CASE("Iterate over native UTF-32")
+{
+    std::u32string str;
+    for (char32_t c = 1; c < 1000; ++c)
+        str.push_back(c);
+    str[10] = Yconvert::INVALID_CHAR;
+    str[500] = Yconvert::INVALID_CHAR;
+
+    auto iterate = [](const void* data, size_t size, Yconvert::ErrorPolicy policy)
+    {
+        Yconvert::CodepointIterator iter(data, size, Yconvert::Encoding::UTF_32_NATIVE,
+                                         policy);
+        std::u32string result;
+        char32_t c;
+        while (iter.next(&c))
+            result.push_back(c);
+        return result;
+    };
+
+    auto expected = str;
+    expected[10] = Yconvert::REPLACEMENT_CHARACTER;
+    expected[500] = Yconvert::REPLACEMENT_CHARACTER;
+
+    // The aligned buffer is read without being copied, but invalid
+    // values are still passed to the decoder, which drops them.
+    auto ignored = str;
+    ignored.erase(500, 1);
+    ignored.erase(10, 1);
+
+    SECTION("Aligned buffer")
+    {
+        REQUIRE(iterate(str.data(), str.size() * 4, Yconvert::ErrorPolicy::REPLACE)
+                == expected);
+        REQUIRE(iterate(str.data(), str.size() * 4 - 1, Yconvert::ErrorPolicy::REPLACE)
+                == expected.substr(0, 998) + U'�');
+        REQUIRE(iterate(str.data(), str.size() * 4, Yconvert::ErrorPolicy::IGNORE)
+                == ignored);
+        REQUIRE_THROWS(iterate(str.data(), str.size() * 4, Yconvert::ErrorPolicy::THROW));
+    }
+
+    SECTION("Unaligned buffer")
+    {
+        std::string bytes(str.size() * 4 + 1, '\0');
+        std::copy_n(reinterpret_cast<const char*>(str.data()), str.size() * 4,
+                    bytes.data() + 1);
+        REQUIRE(iterate(bytes.data() + 1, str.size() * 4, Yconvert::ErrorPolicy::REPLACE)
+                == expected);
+        REQUIRE(iterate(bytes.data() + 1, str.size() * 4, Yconvert::ErrorPolicy::IGNORE)
+                == ignored);
+    }
+}
+
+TEST_CASE("Read chunks of code points")
+{
+    std::string text;
+    for (int i = 0; i < 100; ++i)
+        text += "Blåbærsyltetøy ";
+    Yconvert::CodepointIterator iter(std::string_view(text), Yconvert::Encoding::UTF_8);
+
+    char32_t c;
+    REQUIRE(iter.next(&c));
+    REQUIRE(c == 'B');
+
+    std::u32string result(1, c);
+    while (true)
+    {
+        auto chunk = iter.next_chunk();
+        if (chunk.empty())
+            break;
+        result += chunk;
+    }
+    REQUIRE(result.size() == 1500);
+    REQUIRE(result.substr(0, 15) == U"Blåbærsyltetøy ");
+    REQUIRE(!iter.next(&c));
+}
+
+TEST_CASE("Read blocks of code points")
+{
+    std::stringstream stream;
+    for (int i = 0; i < 100; ++i)
+        stream << "Blåbærsyltetøy ";
+    Yconvert::CodepointIterator iter(stream, Yconvert::Encoding::UTF_8);
+
+    std::vector<char32_t> block(1000);
+    REQUIRE(iter.next_block(std::span(block.data(), 2)) == 2);
+    REQUIRE(block[1] == U'l');
+    REQUIRE(iter.next_block(block) == 1000);
+    REQUIRE(block[0] == U'å');
+    REQUIRE(iter.next_block(block) == 498);
+    REQUIRE(block[497] == U' ');
+    REQUIRE(iter.next_block(block) == 0);
+}
+
+TEST_CASE("Set the buffer size")
+{
+    std::string text;
+    for (int i = 0; i < 100; ++i)
+        text += "Blåbærsyltetøy ";
+    for (size_t size : {1, 10, 256, 2000})
+    {
+        Yconvert::CodepointIterator iter(std::string_view(text),
+                                         Yconvert::Encoding::UTF_8);
+        iter.set_buffer_size(size);
+        auto chunk = iter.next_chunk();
+        REQUIRE(chunk.size() == std::min<size_t>(size, 1500));
+        REQUIRE(chunk[0] == U'B');
+        size_t total = chunk.size();
+        while (!(chunk = iter.next_chunk()).empty())
+            total += chunk.size();
+        REQUIRE(total == 1500);
+    }
+}
+
+TEST_CASE("Change the buffer size while iterating")
+{
+    std::string text;
+    std::u32string expected;
+    for (int i = 0; i < 100; ++i)
+    {
+        text += "Blåbærsyltetøy ";
+        expected += U"Blåbærsyltetøy ";
+    }
+
+    Yconvert::CodepointIterator iter(std::string_view(text),
+                                     Yconvert::Encoding::UTF_8);
+    std::u32string result;
+    char32_t c;
+    // Grow and shrink the buffer, and switch between the default and
+    // a custom buffer, while decoded code points remain.
+    for (size_t size : {size_t(100), size_t(5000), size_t(10),
+                        Yconvert::CodepointIterator::DEFAULT_BUFFER_SIZE,
+                        size_t(3)})
+    {
+        iter.set_buffer_size(size);
+        REQUIRE(iter.next(&c));
+        result.push_back(c);
+    }
+
+    // The rest of the first buffer is returned before the new size
+    // takes effect.
+    iter.set_buffer_size(1000);
+    auto chunk = iter.next_chunk();
+    REQUIRE(chunk.size() == 95);
+    result.append(chunk.begin(), chunk.end());
+    chunk = iter.next_chunk();
+    REQUIRE(chunk.size() == 1000);
+    result.append(chunk.begin(), chunk.end());
+
+    while (iter.next(&c))
+        result.push_back(c);
+    REQUIRE(result == expected);
+}
+
+TEST_CASE("Iterate with BufferCodepointIterator")
+{
+    SECTION("UTF-8")
+    {
+        std::string_view text = "Blåbærsyltetøy";
+        Yconvert::BufferCodepointIterator<4> iter(text, Yconvert::Encoding::UTF_8);
+        std::u32string result;
+        char32_t c;
+        while (iter.next(&c))
+            result.push_back(c);
+        REQUIRE(result == U"Blåbærsyltetøy");
+    }
+
+    SECTION("UTF-16 with an invalid code unit")
+    {
+        std::u16string_view text = u"Blå\xDC00" u"bær";
+        Yconvert::BufferCodepointIterator iter(text, Yconvert::Encoding::UTF_16_NATIVE);
+        std::vector<char32_t> result(10);
+        result.resize(iter.next_block(result));
+        REQUIRE(std::u32string_view(result.data(), result.size()) == U"Blå�bær");
+    }
+
+    SECTION("Native UTF-32")
+    {
+        std::u32string_view text = U"Blåbær";
+        Yconvert::BufferCodepointIterator<2> iter(text, Yconvert::Encoding::UTF_32_NATIVE);
+        auto chunk = iter.next_chunk();
+        REQUIRE(chunk.data() == text.data());
+        REQUIRE(chunk == text);
+        REQUIRE(iter.next_chunk().empty());
+    }
+
+    SECTION("ASCII")
+    {
+        std::string_view text = "Hello!";
+        Yconvert::BufferCodepointIterator<2> iter(text, Yconvert::Encoding::ASCII);
+        REQUIRE(iter.next_chunk() == U"He");
+        REQUIRE(iter.next_chunk() == U"ll");
+        REQUIRE(iter.next_chunk() == U"o!");
+        REQUIRE(iter.next_chunk().empty());
+    }
+}
@@ -0,0 +1,77 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/CodepointView.hpp"
+
+#include <algorithm>
+#include <ranges>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+static_assert(std::ranges::forward_range<Yconvert::CodepointView>);
+static_assert(!std::ranges::sized_range<Yconvert::CodepointView>);
+static_assert(std::ranges::view<Yconvert::CodepointView>);
+
+TEST_CASE("Iterate over a CodepointView")
+{
+    std::string_view text = "Blåbærsyltetøy";
+    auto view = Yconvert::codepoints(text, Yconvert::Encoding::UTF_8);
+    std::u32string result;
+    for (auto c : view)
+        result.push_back(c);
+    REQUIRE(result == U"Blåbærsyltetøy");
+    REQUIRE(view.count() == 14);
+    REQUIRE(std::ranges::distance(view) == 14);
+    REQUIRE(!view.empty());
+}
+
+TEST_CASE("CodepointView is a forward range")
+{
+    std::u16string_view text = u"abc\xD800" u"def";
+    auto view = Yconvert::codepoints(text, Yconvert::Encoding::UTF_16_NATIVE);
+    auto it = view.begin();
+    auto copy = it;
+    REQUIRE(*++it == U'b');
+    REQUIRE(*copy == U'a');
+    REQUIRE(copy != it);
+    REQUIRE(++copy == it);
+
+    auto pos = std::ranges::find(view, U'�');
+    REQUIRE(std::ranges::distance(view.begin(), pos) == 3);
+    REQUIRE(view.count() == 7);
+}
+
+TEST_CASE("Combine CodepointView with std::views")
+{
+    std::string_view text = "Hello, world!";
+    auto letters = Yconvert::codepoints(text, Yconvert::Encoding::UTF_8)
+                   | std::views::filter([](char32_t c) {return c >= 'a' && c <= 'z';})
+                   | std::views::take(6);
+    std::u32string result;
+    std::ranges::copy(letters, std::back_inserter(result));
+    REQUIRE(result == U"ellowo");
+}
+
+TEST_CASE("Copy a CodepointView to a buffer")
+{
+    std::string text;
+    for (int i = 0; i < 100; ++i)
+        text += "Blåbærsyltetøy ";
+    auto view = Yconvert::codepoints(std::string_view(text), Yconvert::Encoding::UTF_8);
+    std::vector<char32_t> buffer(view.count());
+    REQUIRE(buffer.size() == 1500);
+    REQUIRE(view.copy_to(buffer) == 1500);
+    REQUIRE(std::ranges::equal(buffer, view));
+}
+
+TEST_CASE("Empty CodepointView")
+{
+    Yconvert::CodepointView view;
+    REQUIRE(view.empty());
+    REQUIRE(view.count() == 0);
+    REQUIRE(Yconvert::codepoints("", 0, Yconvert::Encoding::UTF_8).empty());
+}
@@ -6,7 +6,11 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include "Yconvert/Convert.hpp"
+#include "Yconvert/ConversionException.hpp"
+#include "Yconvert/OffsetMap.hpp"
 
+#include <algorithm>
+#include <cstdio>
 #include <sstream>
 #include <catch2/catch_test_macros.hpp>
 #include "U8Adapter.hpp"
@@ -161,3 +165,275 @@ TEST_CASE("Convert a UTF-8 stream to a UTF-16 stream")
     std::string expected("A\0B\0\xE7\0\xF1\0", 8);
     REQUIRE(os.str() == expected);
 }
+
+#ifndef _WIN32
+
+namespace
+{
+    std::string read_file(FILE* file)
+    {
+        std::string result;
+        char buffer[256];
+        rewind(file);
+        while (auto n = fread(buffer, 1, sizeof(buffer), file))
+            result.append(buffer, n);
+        return result;
+    }
+}
+
+TEST_CASE("Convert between file descriptors")
+{
+    FILE* src = tmpfile();
+    FILE* dst = tmpfile();
+    REQUIRE(src);
+    REQUIRE(dst);
+    std::string s(reinterpret_cast<const char*>(LONG_STRING),
+                  sizeof(LONG_STRING) - 1);
+    fwrite(s.data(), 1, s.size(), src);
+    fflush(src);
+    rewind(src);
+
+    SECTION("UTF-8 -> UTF-32")
+    {
+        convert_fd(fileno(src), Encoding::UTF_8,
+                   fileno(dst), Encoding::WSTRING_NATIVE);
+        auto result = read_file(dst);
+        REQUIRE(result.size() == LONG_WSTRING.size() * sizeof(wchar_t));
+        REQUIRE(std::wstring_view(reinterpret_cast<const wchar_t*>(result.data()),
+                                  LONG_WSTRING.size()) == LONG_WSTRING);
+    }
+
+    SECTION("Plain copy")
+    {
+        convert_fd(fileno(src), Encoding::UTF_8,
+                   fileno(dst), Encoding::UTF_8,
+                   ErrorPolicy::IGNORE);
+        REQUIRE(read_file(dst) == s);
+    }
+
+    SECTION("Plain copy with an offset map")
+    {
+        OffsetMap map;
+        Converter converter(Encoding::UTF_8, Encoding::UTF_8);
+        converter.set_error_policy(ErrorPolicy::IGNORE);
+        converter.set_offset_map(&map);
+        convert_fd(fileno(src), fileno(dst), converter);
+        REQUIRE(read_file(dst) == s);
+        REQUIRE(map.source_size() == s.size());
+        REQUIRE(map.destination_size() == s.size());
+    }
+
+    fclose(src);
+    fclose(dst);
+}
+
+#endif
+
+TEST_CASE("Convert a UTF-8 stream spanning several chunks to UTF-16")
+{
+    // Three-byte characters ensure that characters are split across the
+    // boundaries between the chunks read from the stream.
+    constexpr auto N = 2 * Details::InputStreamWrapper::DEFAULT_CAPACITY / 3 + 7;
+    std::stringstream ss;
+    for (size_t i = 0; i < N; ++i)
+        ss.write("\xE2\x82\xAC", 3);
+    ss.seekg(0, std::ios::beg);
+    auto result = convert_to<std::u16string>(ss, Encoding::UTF_8,
+                                             Encoding::UTF_16_NATIVE);
+    REQUIRE(result == std::u16string(N, u'€'));
+}
+
+namespace
+{
+    /**
+     * @brief A stringbuf that records the largest number of bytes that
+     *  has been requested in one read.
+     */
+    class RecordingBuf : public std::stringbuf
+    {
+    public:
+        explicit RecordingBuf(const std::string& s)
+            : std::stringbuf(s, std::ios::in)
+        {}
+
+        std::streamsize max_request = 0;
+    protected:
+        std::streamsize xsgetn(char_type* s, std::streamsize n) override
+        {
+            max_request = std::max(max_request, n);
+            return std::stringbuf::xsgetn(s, n);
+        }
+    };
+}
+
+TEST_CASE("InputStreamWrapper capacity")
+{
+    std::istringstream ss("abc");
+    REQUIRE(Details::InputStreamWrapper(ss).capacity()
+            == DEFAULT_STREAM_BUFFER_SIZE);
+    REQUIRE(Details::InputStreamWrapper(ss, 1000).capacity() == 1000);
+    REQUIRE(Details::InputStreamWrapper(ss, 1).capacity()
+            == Details::InputStreamWrapper::MIN_CAPACITY);
+}
+
+TEST_CASE("Convert a stream with a small buffer")
+{
+    constexpr size_t N = 1000;
+    std::string s;
+    for (size_t i = 0; i < N; ++i)
+        s += "\xE2\x82\xAC";
+
+    SECTION("To string")
+    {
+        RecordingBuf buf(s);
+        std::istream stream(&buf);
+        auto result = convert_to<std::u16string>(stream, Encoding::UTF_8,
+                                                 Encoding::UTF_16_NATIVE,
+                                                 ErrorPolicy::REPLACE, 1000);
+        REQUIRE(result == std::u16string(N, u'€'));
+        REQUIRE(buf.max_request == 1000);
+    }
+
+    SECTION("To stream")
+    {
+        RecordingBuf buf(s);
+        std::istream stream(&buf);
+        std::ostringstream os;
+        convert(stream, Encoding::UTF_8, os, Encoding::UTF_32_NATIVE,
+                ErrorPolicy::REPLACE, 1000);
+        REQUIRE(os.str().size() == N * 4);
+        REQUIRE(buf.max_request == 1000);
+    }
+
+    SECTION("Pipelined")
+    {
+        RecordingBuf buf(s);
+        std::istream stream(&buf);
+        std::ostringstream os;
+        convert_pipelined(stream, Encoding::UTF_8, os, Encoding::UTF_32_NATIVE,
+                          ErrorPolicy::REPLACE, 1000);
+        REQUIRE(os.str().size() == N * 4);
+        REQUIRE(buf.max_request == 1000);
+    }
+}
+
+TEST_CASE("Convert a large UTF-8 stream to a UTF-16 stream with convert_pipelined")
+{
+    constexpr size_t N = 100'000;
+    std::stringstream ss;
+    for (size_t i = 0; i < N; ++i)
+        ss.write("a\xC3\xA6\xE2\x82\xAC\xF0\x9F\x98\x80", 10);
+    ss.seekg(0, std::ios::beg);
+    std::stringstream os;
+    convert_pipelined(ss, Encoding::UTF_8, os, Encoding::UTF_16_NATIVE);
+
+    std::u16string expected;
+    for (size_t i = 0; i < N; ++i)
+        expected += u"aæ€\U0001F600";
+    auto result = os.str();
+    REQUIRE(result.size() == expected.size() * 2);
+    REQUIRE(std::u16string_view(reinterpret_cast<const char16_t*>(result.data()),
+                                expected.size()) == expected);
+}
+
+TEST_CASE("convert_pipelined passes on exceptions from the reader")
+{
+    std::string s(50'000, 'a');
+    s += "\xFF";
+    std::istringstream ss(s);
+    std::ostringstream os;
+    Converter converter(Encoding::UTF_8, Encoding::UTF_16_LE);
+    converter.set_error_policy(ErrorPolicy::THROW);
+    try
+    {
+        convert_pipelined(ss, os, converter);
+        FAIL("No exception thrown.");
+    }
+    catch (ConversionException& ex)
+    {
+        REQUIRE(ex.codepoint_offset == 50'000);
+    }
+}
+
+TEST_CASE("convert_pipelined with an offset map")
+{
+    std::string s;
+    while (s.size() < 100'000)
+        s += U8("Blåbærsyltetøy \U0001F600 ");
+    std::istringstream ss(s);
+    std::ostringstream os;
+    OffsetMap map;
+    Converter converter(Encoding::UTF_8, Encoding::UTF_16_LE);
+    converter.set_offset_map(&map);
+    convert_pipelined(ss, os, converter);
+    REQUIRE(os.str() == convert_to<std::string>(s, Encoding::UTF_8,
+                                                 Encoding::UTF_16_LE));
+    REQUIRE(map.source_size() == s.size());
+    REQUIRE(map.destination_size() == os.str().size());
+}
+
+TEST_CASE("convert_auto with buffer")
+{
+    auto text = convert_to<std::string>(std::u16string_view(u"Blåbærsyltetøy"),
+                                        Encoding::UTF_16_NATIVE,
+                                        Encoding::UTF_8);
+    SECTION("Byte-order mark")
+    {
+        auto source = convert_to<std::string>(
+            std::u16string_view(u"\uFEFFBlåbærsyltetøy"),
+            Encoding::UTF_16_NATIVE, Encoding::UTF_16_BE);
+        std::string result;
+        REQUIRE(convert_auto(std::string_view(source), result, Encoding::UTF_8)
+                == Encoding::UTF_16_BE);
+        REQUIRE(result == text);
+    }
+    SECTION("No byte-order mark")
+    {
+        std::string result = "x";
+        REQUIRE(convert_auto(std::string_view(text), result, Encoding::UTF_8)
+                == Encoding::UTF_8);
+        REQUIRE(result == "x" + text);
+    }
+    SECTION("Empty source")
+    {
+        std::string result;
+        REQUIRE(convert_auto("", 0, result, Encoding::UTF_8)
+                == Encoding::UNKNOWN);
+        REQUIRE(result.empty());
+    }
+}
+
+TEST_CASE("convert_auto with stream")
+{
+    std::string source = "\xEF\xBB\xBF";
+    for (size_t i = 0; i < 10'000; ++i)
+        source += "aæ€\xF0\x9F\x98\x80";
+    std::u32string expected;
+    for (size_t i = 0; i < 10'000; ++i)
+        expected += U"aæ€\U0001F600";
+
+    SECTION("To string")
+    {
+        std::istringstream ss(source);
+        std::string result;
+        REQUIRE(convert_auto(ss, result, Encoding::UTF_32_NATIVE)
+                == Encoding::UTF_8);
+        REQUIRE(result.size() == expected.size() * 4);
+        REQUIRE(std::u32string_view(reinterpret_cast<const char32_t*>(result.data()),
+                                    expected.size()) == expected);
+    }
+    SECTION("To stream")
+    {
+        std::istringstream ss(source);
+        std::ostringstream os;
+        REQUIRE(convert_auto(ss, os, Encoding::UTF_8) == Encoding::UTF_8);
+        REQUIRE(os.str() == source.substr(3));
+    }
+    SECTION("Empty stream")
+    {
+        std::istringstream ss;
+        std::ostringstream os;
+        REQUIRE(convert_auto(ss, os, Encoding::UTF_8) == Encoding::UNKNOWN);
+        REQUIRE(os.str().empty());
+    }
+}
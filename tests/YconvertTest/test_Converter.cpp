@@ -6,6 +6,7 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include "Yconvert/Converter.hpp"
+#include "Yconvert/ConversionException.hpp"
 #include "U8Adapter.hpp"
 #include <catch2/catch_test_macros.hpp>
 
@@ -72,3 +73,190 @@ TEST_CASE("Converter with iso8859-1 -> UTF-16")
     REQUIRE(n == t.size() * 2);
     REQUIRE(t == u"Aäö?Øõ");
 }
+
+TEST_CASE("Converter with UTF-8 -> iso8859-1 and small output buffer")
+{
+    Converter converter(Encoding::UTF_8, Encoding::ISO_8859_1);
+    std::string s(U8("Blåbærsyltetøy"));
+    std::string t(6, '\0');
+    auto [m, n] = converter.convert(s.data(), s.size(), t.data(), t.size());
+    REQUIRE(m == 8);
+    REQUIRE(n == 6);
+    REQUIRE(t == "Bl\xE5""b\xE6r");
+}
+
+namespace
+{
+    template <typename CharT>
+    std::basic_string<CharT> swap_bytes(std::basic_string<CharT> s)
+    {
+        for (auto& c : s)
+            c = reverse_bytes(c);
+        return s;
+    }
+
+    template <typename CharT>
+    std::string to_bytes(const std::basic_string<CharT>& s)
+    {
+        return {reinterpret_cast<const char*>(s.data()), s.size() * sizeof(CharT)};
+    }
+}
+
+TEST_CASE("Converter between UTF-16 and UTF-32 in all byte orders")
+{
+    std::u16string u16;
+    std::u32string u32;
+    for (int i = 0; i < 10; ++i)
+    {
+        u16 += u"Blåbærsyltetøy, \U0001F600\U0001F601 €";
+        u32 += U"Blåbærsyltetøy, \U0001F600\U0001F601 €";
+    }
+    auto u16_le = to_bytes(IS_LITTLE_ENDIAN ? u16 : swap_bytes(u16));
+    auto u16_be = to_bytes(IS_BIG_ENDIAN ? u16 : swap_bytes(u16));
+    auto u32_le = to_bytes(IS_LITTLE_ENDIAN ? u32 : swap_bytes(u32));
+    auto u32_be = to_bytes(IS_BIG_ENDIAN ? u32 : swap_bytes(u32));
+
+    std::pair<Encoding, const std::string*> utf16[] = {
+        {Encoding::UTF_16_LE, &u16_le}, {Encoding::UTF_16_BE, &u16_be}};
+    std::pair<Encoding, const std::string*> utf32[] = {
+        {Encoding::UTF_32_LE, &u32_le}, {Encoding::UTF_32_BE, &u32_be}};
+
+    for (auto [enc16, str16] : utf16)
+    {
+        for (auto [enc32, str32] : utf32)
+        {
+            Converter to32(enc16, enc32);
+            REQUIRE(to32.get_encoded_size(str16->data(), str16->size()) == str32->size());
+            std::string result(str32->size(), '\0');
+            auto [m, n] = to32.convert(str16->data(), str16->size(),
+                                       result.data(), result.size());
+            REQUIRE(m == str16->size());
+            REQUIRE(n == str32->size());
+            REQUIRE(result == *str32);
+
+            Converter to16(enc32, enc16);
+            REQUIRE(to16.get_encoded_size(str32->data(), str32->size()) == str16->size());
+            result.clear();
+            REQUIRE(to16.convert(str32->data(), str32->size(), result) == str32->size());
+            REQUIRE(result == *str16);
+        }
+    }
+}
+
+TEST_CASE("Converter UTF-16 -> UTF-32 with invalid input")
+{
+    std::u16string s;
+    for (int i = 0; i < 10; ++i)
+        s += u"Blåbærsyltetøy, \U0001F600 €";
+    s[30] = 0xDC00;
+
+    Converter converter(Encoding::UTF_16_NATIVE, Encoding::UTF_32_NATIVE);
+
+    SECTION("Replace")
+    {
+        converter.set_error_policy(ErrorPolicy::REPLACE);
+        std::u32string t(s.size(), U'\0');
+        auto [m, n] = converter.convert(s.data(), s.size() * 2,
+                                        t.data(), t.size() * 4);
+        REQUIRE(m == s.size() * 2);
+        REQUIRE(n == (s.size() - 10) * 4);
+        REQUIRE(t[29] == REPLACEMENT_CHARACTER);
+        REQUIRE(t[30] == U't');
+    }
+
+    SECTION("Throw")
+    {
+        converter.set_error_policy(ErrorPolicy::THROW);
+        std::string t;
+        try
+        {
+            converter.convert(s.data(), s.size() * 2, t);
+            FAIL("No exception thrown.");
+        }
+        catch (ConversionException& ex)
+        {
+            REQUIRE(ex.codepoint_offset == 29);
+        }
+    }
+
+    SECTION("Small output buffer")
+    {
+        std::u32string t(12, U'\0');
+        auto [m, n] = converter.convert(s.data(), s.size() * 2,
+                                        t.data(), t.size() * 4);
+        REQUIRE(m == 24);
+        REQUIRE(n == 48);
+        REQUIRE(t == U"Blåbærsyltet");
+    }
+
+    SECTION("Incomplete surrogate pair at the end of the input")
+    {
+        std::string t;
+        auto n = converter.convert(s.data(), 17 * 2, t, false);
+        REQUIRE(n == 16 * 2);
+        REQUIRE(t.size() == 16 * 4);
+    }
+}
+
+TEST_CASE("Converter UTF-8 -> UTF-16 get_encoded_size")
+{
+    std::string s;
+    for (int i = 0; i < 10; ++i)
+        s += U8("Blåbærsyltetøy, \U0001F600 € and some ASCII text.");
+    // Overlong and out-of-range four-byte sequences.
+    s += "\xF0\x80\x80\x80" "abc" "\xF4\x90\x80\x80" "abcdefghijklmnop";
+    s += U8("\U0001F601");
+
+    Converter converter(Encoding::UTF_8, Encoding::UTF_16_LE);
+    converter.set_error_policy(ErrorPolicy::REPLACE);
+    for (size_t i = 0; i <= s.size(); ++i)
+    {
+        std::string result;
+        converter.convert(s.data(), i, result);
+        REQUIRE(converter.get_encoded_size(s.data(), i) == result.size());
+    }
+
+    SECTION("Invalid sequence")
+    {
+        s[100] = '\xFF';
+        std::string result;
+        converter.convert(s.data(), s.size(), result);
+        REQUIRE(converter.get_encoded_size(s.data(), s.size()) == result.size());
+    }
+}
+
+#ifdef YCONVERT_DOS_CODE_PAGES
+TEST_CASE("Converter with UTF-8 -> DOS code page 437")
+{
+    Converter converter(Encoding::UTF_8, Encoding::DOS_CP437);
+    std::string t;
+    REQUIRE(converter.convert(U8("Aäö"), 5, t) == 5);
+    REQUIRE(t == "A\x84\x94");
+}
+#endif
+
+#ifdef YCONVERT_WIN_CODE_PAGES
+TEST_CASE("Converter with Windows code page 1252 -> UTF-8")
+{
+    Converter converter(Encoding::WIN_CP1252, Encoding::UTF_8);
+    std::string t;
+    REQUIRE(converter.convert("A\x80\xE4", 3, t) == 3);
+    REQUIRE(t == U8("A€ä"));
+}
+#endif
+
+TEST_CASE("Converter::is_copy")
+{
+    Converter converter(Encoding::UTF_16_LE, Encoding::UTF_16_BE);
+    REQUIRE_FALSE(converter.is_copy());
+    converter.set_error_policy(ErrorPolicy::IGNORE);
+    REQUIRE(converter.is_copy());
+
+    Converter same(Encoding::UTF_8, Encoding::UTF_8);
+    same.set_error_policy(ErrorPolicy::IGNORE);
+    REQUIRE(same.is_copy());
+
+    Converter transcoder(Encoding::UTF_16_LE, Encoding::UTF_32_LE);
+    transcoder.set_error_policy(ErrorPolicy::IGNORE);
+    REQUIRE_FALSE(transcoder.is_copy());
+}
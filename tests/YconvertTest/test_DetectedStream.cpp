@@ -0,0 +1,122 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/DetectedStream.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include "Yconvert/CodepointIterator.hpp"
+#include "Yconvert/Convert.hpp"
+
+namespace
+{
+    const std::u32string TEXT = U"Det var en gang en gutt som het Pål. "
+                                U"Han likte blåbærsyltetøy og rømmegrøt.";
+
+    /**
+     * @brief A streambuf that returns at most 100 bytes at a time and
+     *  can't seek, like a pipe.
+     */
+    class PipeBuf : public std::streambuf
+    {
+    public:
+        explicit PipeBuf(std::string data)
+            : data_(std::move(data))
+        {}
+    protected:
+        int_type underflow() override
+        {
+            if (offset_ == data_.size())
+                return traits_type::eof();
+            auto begin = data_.data() + offset_;
+            offset_ = std::min(offset_ + 100, data_.size());
+            setg(begin, begin, data_.data() + offset_);
+            return traits_type::to_int_type(*begin);
+        }
+    private:
+        std::string data_;
+        size_t offset_ = 0;
+    };
+
+    std::string encode(const std::u32string& text, Yconvert::Encoding encoding)
+    {
+        return Yconvert::convert_to<std::string>(
+            text, Yconvert::Encoding::UTF_32_NATIVE, encoding);
+    }
+
+    std::string convert(Yconvert::DetectedStream& stream)
+    {
+        Yconvert::Converter converter(stream.encoding(),
+                                      Yconvert::Encoding::UTF_8);
+        return Yconvert::convert_to<std::string>(stream, converter);
+    }
+}
+
+TEST_CASE("DetectedStream with byte-order mark")
+{
+    using Yconvert::Encoding;
+    PipeBuf buf("\xFF\xFE" + encode(TEXT, Encoding::UTF_16_LE));
+    std::istream pipe(&buf);
+    REQUIRE(pipe.tellg() == -1);
+    Yconvert::DetectedStream stream(pipe);
+    REQUIRE(stream.encoding() == Encoding::UTF_16_LE);
+    REQUIRE(stream.byte_order_mark_size() == 2);
+    REQUIRE(convert(stream) == encode(TEXT, Encoding::UTF_8));
+}
+
+TEST_CASE("DetectedStream with CodepointIterator")
+{
+    using Yconvert::Encoding;
+    PipeBuf buf(encode(TEXT, Encoding::UTF_16_BE));
+    std::istream pipe(&buf);
+    Yconvert::DetectedStream stream(pipe);
+    REQUIRE(stream.encoding() == Encoding::UTF_16_BE);
+    REQUIRE(stream.byte_order_mark_size() == 0);
+    Yconvert::CodepointIterator it(stream, stream.encoding());
+    std::u32string result;
+    char32_t c;
+    while (it.next(&c))
+        result.push_back(c);
+    REQUIRE(result == TEXT);
+}
+
+TEST_CASE("DetectedStream continues after the prefix")
+{
+    using Yconvert::Encoding;
+    // The encoding is decided long before the end of the stream.
+    std::u32string text;
+    while (text.size() < 100'000)
+        text += TEXT;
+    PipeBuf buf(encode(text, Encoding::UTF_8));
+    std::istream pipe(&buf);
+    Yconvert::DetectedStream stream(pipe);
+    REQUIRE(stream.encoding() == Encoding::UTF_8);
+    REQUIRE(convert(stream) == encode(text, Encoding::UTF_8));
+}
+
+TEST_CASE("DetectedStream reads single characters")
+{
+    std::string text(10'000, 'a');
+    text += "bc";
+    PipeBuf buf(text);
+    std::istream pipe(&buf);
+    Yconvert::DetectedStream stream(pipe, 1000);
+    REQUIRE(stream.encoding() == Yconvert::Encoding::UTF_8);
+    std::string result;
+    char c;
+    while (stream.get(c))
+        result.push_back(c);
+    REQUIRE(result == text);
+}
+
+TEST_CASE("DetectedStream with empty stream")
+{
+    PipeBuf buf("");
+    std::istream pipe(&buf);
+    Yconvert::DetectedStream stream(pipe);
+    REQUIRE(stream.encoding() == Yconvert::Encoding::UNKNOWN);
+    REQUIRE(stream.get() == std::char_traits<char>::eof());
+}
@@ -0,0 +1,130 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/EncodedLength.hpp"
+
+#include <string>
+#include <catch2/catch_test_macros.hpp>
+#include "U8Adapter.hpp"
+
+using namespace Yconvert;
+
+TEST_CASE("UTF-16 length from UTF-8")
+{
+    std::string s;
+    std::u16string expected;
+    for (int i = 0; i < 10; ++i)
+    {
+        s += U8("Blåbærsyltetøy, \U0001F600 € and some ASCII text.");
+        expected += u"Blåbærsyltetøy, \U0001F600 € and some ASCII text.";
+    }
+
+    auto result = utf16_length_from_utf8(s);
+    REQUIRE(result.length == expected.size());
+    REQUIRE(result.valid);
+
+    SECTION("Empty string")
+    {
+        result = utf16_length_from_utf8({});
+        REQUIRE(result.length == 0);
+        REQUIRE(result.valid);
+    }
+
+    SECTION("Invalid byte")
+    {
+        s[120] = '\xFF';
+        result = utf16_length_from_utf8(s);
+        REQUIRE(!result.valid);
+        REQUIRE(result.length == utf16_length_from_utf8({s.data(), 120}).length);
+    }
+
+    SECTION("Incomplete code point at the end")
+    {
+        s += "\xF0\x9F\x98";
+        result = utf16_length_from_utf8(s);
+        REQUIRE(!result.valid);
+        REQUIRE(result.length == expected.size());
+    }
+
+    SECTION("Code point above U+10FFFF")
+    {
+        s += "\xF4\x90\x80\x80";
+        result = utf16_length_from_utf8(s);
+        REQUIRE(!result.valid);
+        REQUIRE(result.length == expected.size());
+    }
+
+    SECTION("Overlong sequences and surrogates")
+    {
+        for (std::string seq : {"\xC0\x80", "\xC1\xBF", "\xE0\x80\x80",
+                                "\xE0\x9F\xBF", "\xED\xA0\x80",
+                                "\xED\xBF\xBF", "\xF0\x80\x80\x80",
+                                "\xF0\x8F\xBF\xBF"})
+        {
+            // Followed by more text to make sure the sequence is found
+            // in the middle of a 16-byte block as well as at the end.
+            for (auto suffix : {std::string(), s})
+            {
+                result = utf16_length_from_utf8(s + seq + suffix);
+                REQUIRE(!result.valid);
+                REQUIRE(result.length == expected.size());
+            }
+        }
+    }
+
+    SECTION("Smallest and largest valid sequences")
+    {
+        s += "\xC2\x80\xE0\xA0\x80\xED\x9F\xBF\xEE\x80\x80"
+             "\xF0\x90\x80\x80\xF4\x8F\xBF\xBF";
+        result = utf16_length_from_utf8(s + s);
+        REQUIRE(result.valid);
+        REQUIRE(result.length == 2 * (expected.size() + 8));
+    }
+}
+
+TEST_CASE("UTF-8 length from UTF-16")
+{
+    std::u16string s;
+    std::string expected;
+    for (int i = 0; i < 10; ++i)
+    {
+        s += u"Blåbærsyltetøy, \U0001F600 € and some ASCII text.";
+        expected += U8("Blåbærsyltetøy, \U0001F600 € and some ASCII text.");
+    }
+
+    auto result = utf8_length_from_utf16(s);
+    REQUIRE(result.length == expected.size());
+    REQUIRE(result.valid);
+
+    SECTION("Swapped byte order")
+    {
+        for (auto& c : s)
+            c = reverse_bytes(c);
+        auto other = IS_LITTLE_ENDIAN ? Endianness::BIG : Endianness::LITTLE;
+        result = utf8_length_from_utf16(s, other);
+        REQUIRE(result.length == expected.size());
+        REQUIRE(result.valid);
+    }
+
+    SECTION("Surrogate pair split by the end of the input")
+    {
+        for (size_t i = 0; i < s.size(); ++i)
+        {
+            auto expected_valid = (s[i] & 0xFC00u) != 0xDC00u;
+            result = utf8_length_from_utf16({s.data(), i});
+            REQUIRE(result.valid == expected_valid);
+        }
+    }
+
+    SECTION("Unpaired low surrogate")
+    {
+        s[100] = 0xDC00;
+        result = utf8_length_from_utf16(s);
+        REQUIRE(!result.valid);
+        REQUIRE(result.length == utf8_length_from_utf16({s.data(), 100}).length);
+    }
+}
@@ -123,3 +123,37 @@ TEST_CASE("Count valid code points in zero-terminated UTF32 string")
     REQUIRE(bytes == 40);
     REQUIRE(Yconvert::check_encoding(u32, sizeof(u32), Encoding::UTF_32_NATIVE));
 }
+
+TEST_CASE("Encoding from name")
+{
+    REQUIRE(encoding_from_name("UTF-8") == Encoding::UTF_8);
+    REQUIRE(encoding_from_name("utf8") == Encoding::UTF_8);
+    REQUIRE(encoding_from_name("Utf-16") == Encoding::UTF_16_NATIVE);
+    REQUIRE(encoding_from_name("ucs-2le") == Encoding::UTF_16_LE);
+    REQUIRE(encoding_from_name("UTF-32BE") == Encoding::UTF_32_BE);
+    REQUIRE(encoding_from_name("us-ascii") == Encoding::ASCII);
+#ifdef YCONVERT_ISO_CODE_PAGES
+    REQUIRE(encoding_from_name("iso_8859-1:1987") == Encoding::ISO_8859_1);
+    REQUIRE(encoding_from_name("LATIN10") == Encoding::ISO_8859_16);
+#endif
+#ifdef YCONVERT_DOS_CODE_PAGES
+    REQUIRE(encoding_from_name("IBM866") == Encoding::DOS_CP866);
+#endif
+#ifdef YCONVERT_WIN_CODE_PAGES
+    REQUIRE(encoding_from_name("cp1252") == Encoding::WIN_CP1252);
+    REQUIRE(encoding_from_name("Windows-1252") == Encoding::WIN_CP1252);
+#endif
+    REQUIRE(encoding_from_name("") == Encoding::UNKNOWN);
+    REQUIRE(encoding_from_name("UTF-9") == Encoding::UNKNOWN);
+    REQUIRE(encoding_from_name("UTF-8 ") == Encoding::UNKNOWN);
+}
+
+TEST_CASE("Encoding from name of every encoding")
+{
+    auto [infos, count] = get_all_encodings();
+    for (size_t i = 0; i < count; ++i)
+    {
+        CAPTURE(infos[i].name);
+        REQUIRE(encoding_from_name(infos[i].name) == infos[i].encoding);
+    }
+}
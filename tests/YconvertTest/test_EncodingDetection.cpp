@@ -0,0 +1,295 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/EncodingDetection.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include "Yconvert/Convert.hpp"
+
+namespace
+{
+    const std::u32string TEXT = U"Det var en gang en gutt som het Pål. "
+                                U"Han likte blåbærsyltetøy og rømmegrøt.";
+
+    std::string encode(const std::u32string& text, Yconvert::Encoding encoding)
+    {
+        return Yconvert::convert_to<std::string>(
+            text, Yconvert::Encoding::UTF_32_NATIVE, encoding);
+    }
+
+    Yconvert::Encoding detect(const std::string& text,
+                              size_t max_size = Yconvert::DEFAULT_DETECTION_SIZE)
+    {
+        auto result = Yconvert::detect_encodings(text.data(), text.size(),
+                                                 max_size);
+        REQUIRE_FALSE(result.empty());
+        for (size_t i = 1; i < result.size(); ++i)
+            REQUIRE(result[i - 1].confidence >= result[i].confidence);
+        return result.front().encoding;
+    }
+
+    void check_detect(Yconvert::Encoding encoding)
+    {
+        CAPTURE(encoding);
+        REQUIRE(detect(encode(TEXT, encoding)) == encoding);
+    }
+}
+
+TEST_CASE("Detect UTF encodings")
+{
+    using Yconvert::Encoding;
+    check_detect(Encoding::UTF_8);
+    check_detect(Encoding::UTF_16_LE);
+    check_detect(Encoding::UTF_16_BE);
+    check_detect(Encoding::UTF_32_LE);
+    check_detect(Encoding::UTF_32_BE);
+}
+
+TEST_CASE("Detect ASCII")
+{
+    using Yconvert::Encoding;
+    std::string text = "Just plain ASCII.\r\n";
+    auto result = Yconvert::detect_encodings(text.data(), text.size());
+    REQUIRE(result.size() >= 2);
+    REQUIRE(result[0].encoding == Encoding::UTF_8);
+    REQUIRE(result[1].encoding == Encoding::ASCII);
+}
+
+TEST_CASE("Detect encoding from byte-order mark")
+{
+    using Yconvert::Encoding;
+    auto text = "\xFF\xFE" + encode(TEXT, Encoding::UTF_16_LE);
+    auto result = Yconvert::detect_encodings(text.data(), text.size());
+    REQUIRE(result[0].encoding == Encoding::UTF_16_LE);
+    REQUIRE(result[0].confidence == 1.0);
+    for (size_t i = 1; i < result.size(); ++i)
+        REQUIRE(result[i].encoding != Encoding::UTF_16_LE);
+}
+
+TEST_CASE("Detect encoding of empty buffer")
+{
+    REQUIRE(Yconvert::detect_encodings("", 0).empty());
+}
+
+TEST_CASE("Detect encoding of prefix")
+{
+    using Yconvert::Encoding;
+    auto text = encode(TEXT, Encoding::UTF_8);
+    // Stop inside the two-byte "å".
+    auto offset = text.find("\xC3\xA5");
+    REQUIRE(detect(text, offset + 1) == Encoding::UTF_8);
+    // The incomplete character is an error at the end of the buffer.
+    REQUIRE(detect(text.substr(0, offset + 1)) != Encoding::UTF_8);
+}
+
+TEST_CASE("EncodingDetector decides on byte-order mark")
+{
+    using Yconvert::Encoding;
+    auto text = "\xEF\xBB\xBF" + encode(TEXT, Encoding::UTF_8);
+    Yconvert::EncodingDetector detector;
+    for (size_t i = 0; i < 3; ++i)
+        REQUIRE_FALSE(detector.add(&text[i], 1));
+    REQUIRE(detector.add(&text[3], 1));
+    REQUIRE(detector.encoding() == Encoding::UTF_8);
+    REQUIRE(detector.byte_order_mark_size() == 3);
+    REQUIRE(detector.candidates().size() == 1);
+    REQUIRE(detector.candidates()[0].confidence == 1.0);
+    // Bytes after the decision are ignored.
+    REQUIRE(detector.add(text.data() + 4, text.size() - 4));
+    REQUIRE(detector.size() == 4);
+}
+
+TEST_CASE("EncodingDetector doesn't decide on invalid UTF-8 alone")
+{
+    using Yconvert::Encoding;
+    auto text = encode(TEXT, Encoding::UTF_16_LE);
+    REQUIRE(text.size() < Yconvert::EncodingDetector::MIN_DECISION_SIZE);
+    Yconvert::EncodingDetector detector;
+    REQUIRE_FALSE(detector.add(text.data(), 16));
+    REQUIRE_FALSE(detector.add(text.data() + 16, text.size() - 16));
+    REQUIRE(detector.encoding() == Encoding::UTF_16_LE);
+    while (!detector.add(text.data(), text.size()))
+        REQUIRE(detector.size() < Yconvert::EncodingDetector::MIN_DECISION_SIZE);
+    REQUIRE(detector.encoding() == Encoding::UTF_16_LE);
+    REQUIRE(detector.byte_order_mark_size() == 0);
+}
+
+TEST_CASE("EncodingDetector decides on confidence")
+{
+    using Yconvert::Encoding;
+    std::string text;
+    while (text.size() < 4 * Yconvert::EncodingDetector::MIN_DECISION_SIZE)
+        text += encode(TEXT, Encoding::UTF_8);
+    Yconvert::EncodingDetector detector;
+    size_t offset = 0;
+    while (!detector.add(text.data() + offset, 16))
+        offset += 16;
+    REQUIRE(detector.size() >= Yconvert::EncodingDetector::MIN_DECISION_SIZE);
+    REQUIRE(detector.size() < Yconvert::EncodingDetector::MIN_DECISION_SIZE + 16);
+    REQUIRE(detector.encoding() == Encoding::UTF_8);
+}
+
+TEST_CASE("EncodingDetector reads ASCII up to the maximum size")
+{
+    using Yconvert::Encoding;
+    std::string text(1000, 'a');
+    Yconvert::EncodingDetector detector(2500);
+    REQUIRE_FALSE(detector.add(text.data(), text.size()));
+    REQUIRE(detector.encoding() == Encoding::UTF_8);
+    REQUIRE_FALSE(detector.add(text.data(), text.size()));
+    REQUIRE(detector.add(text.data(), text.size()));
+    REQUIRE(detector.size() == 2500);
+    REQUIRE(detector.encoding() == Encoding::UTF_8);
+}
+
+TEST_CASE("EncodingDetector decides on finish")
+{
+    using Yconvert::Encoding;
+    SECTION("Short text")
+    {
+        Yconvert::EncodingDetector detector;
+        REQUIRE_FALSE(detector.add("abc", 3));
+        detector.finish();
+        REQUIRE(detector.is_done());
+        REQUIRE(detector.encoding() == Encoding::UTF_8);
+    }
+    SECTION("Short byte-order mark")
+    {
+        Yconvert::EncodingDetector detector;
+        REQUIRE_FALSE(detector.add("\xFE\xFF", 2));
+        detector.finish();
+        REQUIRE(detector.encoding() == Encoding::UTF_16_BE);
+        REQUIRE(detector.byte_order_mark_size() == 2);
+    }
+    SECTION("Incomplete character")
+    {
+        auto text = encode(TEXT, Encoding::UTF_8);
+        auto offset = text.find("\xC3\xA5");
+        Yconvert::EncodingDetector detector;
+        REQUIRE_FALSE(detector.add(text.data(), offset + 1));
+        REQUIRE(detector.encoding() == Encoding::UTF_8);
+        detector.finish();
+        REQUIRE(detector.encoding() != Encoding::UTF_8);
+    }
+    SECTION("Empty text")
+    {
+        Yconvert::EncodingDetector detector;
+        detector.finish();
+        REQUIRE(detector.is_done());
+        REQUIRE(detector.encoding() == Encoding::UNKNOWN);
+        REQUIRE(detector.candidates().empty());
+    }
+}
+
+namespace
+{
+    const std::u32string RUSSIAN = U"Однажды весной, в час небывало жаркого "
+                                   U"заката, в Москве, на Патриарших прудах, "
+                                   U"появились два гражданина.";
+
+    const std::u32string GREEK = U"Η Ελλάδα είναι χώρα της νοτιοανατολικής "
+                                 U"Ευρώπης, στο νότιο άκρο της Βαλκανικής "
+                                 U"χερσονήσου. Άλλοι την λένε Ελλάς.";
+
+    const std::u32string POLISH = U"Zażółć gęślą jaźń. Pchnąć w tę łódź jeża "
+                                  U"lub ośm skrzyń fig.";
+
+    const std::u32string CHINESE = U"中华人民共和国是位于东亚的社会主义国家，"
+                                   U"首都北京。全国总面积约九百六十万平方公里。";
+
+    const std::u32string JAPANESE = U"日本は東アジアに位置する島国である。"
+                                    U"首都は東京。";
+
+    void check_detect(const std::u32string& text, Yconvert::Encoding encoding)
+    {
+        CAPTURE(encoding);
+        REQUIRE(detect(encode(text, encoding)) == encoding);
+    }
+
+    Yconvert::Encoding detect_in_chunks(const std::string& text,
+                                        size_t chunk_size)
+    {
+        Yconvert::EncodingDetector detector;
+        for (size_t i = 0; i < text.size() && !detector.is_done(); i += chunk_size)
+        {
+            if (detector.add(text.data() + i, std::min(chunk_size, text.size() - i)))
+                REQUIRE(detector.size() >= Yconvert::EncodingDetector::MIN_DECISION_SIZE);
+        }
+        detector.finish();
+        return detector.encoding();
+    }
+}
+
+TEST_CASE("Detect UTF-16 without zero bytes")
+{
+    using Yconvert::Encoding;
+    check_detect(CHINESE, Encoding::UTF_16_LE);
+    check_detect(CHINESE, Encoding::UTF_16_BE);
+    check_detect(JAPANESE, Encoding::UTF_16_LE);
+    check_detect(JAPANESE, Encoding::UTF_16_BE);
+    auto text = encode(CHINESE, Encoding::UTF_16_LE);
+    REQUIRE(detect_in_chunks(text, 16) == Encoding::UTF_16_LE);
+}
+
+#ifdef YCONVERT_WIN_CODE_PAGES
+
+TEST_CASE("Detect Windows code pages")
+{
+    using Yconvert::Encoding;
+    check_detect(RUSSIAN, Encoding::WIN_CP1251);
+    check_detect(GREEK, Encoding::WIN_CP1253);
+    check_detect(POLISH, Encoding::WIN_CP1250);
+    check_detect(TEXT, Encoding::WIN_CP1252);
+}
+
+TEST_CASE("Detect CP1252 that starts with ASCII")
+{
+    using Yconvert::Encoding;
+    std::string text(20000, 'a');
+    text += encode(TEXT, Encoding::WIN_CP1252);
+    REQUIRE(detect(text) == Encoding::WIN_CP1252);
+    // The non-ASCII characters are beyond the scanned prefix.
+    REQUIRE(detect(text, 1000) == Encoding::UTF_8);
+}
+
+#endif
+
+#ifdef YCONVERT_ISO_CODE_PAGES
+
+TEST_CASE("Detect ISO 8859 code pages")
+{
+    using Yconvert::Encoding;
+    check_detect(RUSSIAN, Encoding::ISO_8859_5);
+    check_detect(GREEK, Encoding::ISO_8859_7);
+    check_detect(POLISH, Encoding::ISO_8859_2);
+}
+
+#endif
+
+#ifdef YCONVERT_DOS_CODE_PAGES
+
+TEST_CASE("Detect DOS code pages")
+{
+    using Yconvert::Encoding;
+    check_detect(RUSSIAN, Encoding::DOS_CP866);
+    check_detect(GREEK, Encoding::DOS_CP737);
+}
+
+TEST_CASE("EncodingDetector with DOS code page in small chunks")
+{
+    using Yconvert::Encoding;
+    auto text = encode(RUSSIAN + U" " + RUSSIAN + U" " + RUSSIAN,
+                       Encoding::DOS_CP866);
+    REQUIRE(text.size() > Yconvert::EncodingDetector::MIN_DECISION_SIZE);
+    REQUIRE(detect(text) == Encoding::DOS_CP866);
+    REQUIRE(detect_in_chunks(text, 16) == Encoding::DOS_CP866);
+    REQUIRE(detect_in_chunks(text.substr(0, 100), 16)
+            == detect(text.substr(0, 100)));
+}
+
+#endif
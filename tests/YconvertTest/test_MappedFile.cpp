@@ -0,0 +1,83 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/MappedFile.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <catch2/catch_test_macros.hpp>
+#include "Yconvert/CodepointIterator.hpp"
+#include "Yconvert/Converter.hpp"
+#include "Yconvert/EncodingChecker.hpp"
+#include "U8Adapter.hpp"
+
+using namespace Yconvert;
+
+namespace
+{
+    struct TemporaryFile
+    {
+        explicit TemporaryFile(std::string_view contents)
+            : path((std::filesystem::temp_directory_path()
+                    / "YconvertTest_MappedFile.txt").string())
+        {
+            std::ofstream file(path, std::ios::binary);
+            file.write(contents.data(), std::streamsize(contents.size()));
+        }
+
+        ~TemporaryFile()
+        {
+            std::error_code ec;
+            std::filesystem::remove(path, ec);
+        }
+
+        std::string path;
+    };
+}
+
+TEST_CASE("Map a file")
+{
+    std::string_view text = U8("Blåbærsyltetøy");
+    TemporaryFile tmp(text);
+    MappedFile file(tmp.path);
+    REQUIRE(std::string_view(file.data(), file.size()) == text);
+
+    SECTION("Convert")
+    {
+        Converter converter(Encoding::UTF_8, Encoding::ISO_8859_1);
+        std::string result;
+        REQUIRE(converter.convert(file, result) == text.size());
+        REQUIRE(result == "Bl\xE5" "b\xE6rsyltet\xF8y");
+    }
+
+    SECTION("Check encoding")
+    {
+        REQUIRE(EncodingChecker(Encoding::UTF_8).check_encoding(file));
+        REQUIRE(!EncodingChecker(Encoding::ASCII).check_encoding(file));
+    }
+
+    SECTION("Iterate")
+    {
+        std::u32string result;
+        for (auto c : CodepointIterator(file, Encoding::UTF_8))
+            result.push_back(c);
+        REQUIRE(result == U"Blåbærsyltetøy");
+    }
+}
+
+TEST_CASE("Map an empty file")
+{
+    TemporaryFile tmp("");
+    MappedFile file(tmp.path);
+    REQUIRE(file.size() == 0);
+    REQUIRE(file.span().empty());
+}
+
+TEST_CASE("Map a file that does not exist")
+{
+    REQUIRE_THROWS(MappedFile("/this/file/does/not/exist.txt"));
+}
@@ -0,0 +1,315 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Yconvert/OffsetMap.hpp"
+
+#include <sstream>
+#include <catch2/catch_test_macros.hpp>
+#include "Yconvert/Convert.hpp"
+#include "Yconvert/YconvertException.hpp"
+
+namespace
+{
+    struct Boundaries
+    {
+        std::vector<size_t> source;
+        std::vector<size_t> destination;
+    };
+
+    // Computes the offsets of each code point by converting them one at
+    // a time.
+    Boundaries get_boundaries(const std::u32string& text,
+                              Yconvert::Encoding src_encoding,
+                              Yconvert::Encoding dst_encoding)
+    {
+        using namespace Yconvert;
+        Boundaries result{{0}, {0}};
+        for (auto c : text)
+        {
+            auto src = convert_to<std::string>(std::u32string_view(&c, 1),
+                                               Encoding::UTF_32_NATIVE,
+                                               src_encoding);
+            auto dst = convert_to<std::string>(std::u32string_view(&c, 1),
+                                               Encoding::UTF_32_NATIVE,
+                                               dst_encoding);
+            result.source.push_back(result.source.back() + src.size());
+            result.destination.push_back(result.destination.back() + dst.size());
+        }
+        return result;
+    }
+
+    void check_map(const Yconvert::OffsetMap& map, const Boundaries& expected)
+    {
+        REQUIRE(map.source_size() == expected.source.back());
+        REQUIRE(map.destination_size() == expected.destination.back());
+        for (size_t i = 0; i < expected.source.size(); ++i)
+        {
+            CAPTURE(i);
+            REQUIRE(map.to_destination(expected.source[i]) == expected.destination[i]);
+            REQUIRE(map.to_source(expected.destination[i]) == expected.source[i]);
+        }
+    }
+
+    const std::u32string TEXT = U"Blåbærsyltetøy, € 12 og \U0001F600!";
+}
+
+TEST_CASE("OffsetMap from UTF-8 to UTF-16")
+{
+    using namespace Yconvert;
+    auto src = convert_to<std::string>(TEXT, Encoding::UTF_32_NATIVE,
+                                       Encoding::UTF_8);
+    OffsetMap map;
+    Converter converter(Encoding::UTF_8, Encoding::UTF_16_LE);
+    converter.set_offset_map(&map);
+    std::string dst;
+    converter.convert(src.data(), src.size(), dst);
+    REQUIRE(map.destination_size() == dst.size());
+    check_map(map, get_boundaries(TEXT, Encoding::UTF_8, Encoding::UTF_16_LE));
+
+    SECTION("Offsets inside a code point are mapped to its start")
+    {
+        // "å" is bytes 2 and 3 in UTF-8.
+        REQUIRE(map.to_destination(3) == 4);
+        // "😀" is the last surrogate pair in UTF-16.
+        REQUIRE(map.to_source(dst.size() - 3) == src.size() - 5);
+    }
+}
+
+TEST_CASE("OffsetMap from UTF-16 to UTF-8")
+{
+    using namespace Yconvert;
+    auto src = convert_to<std::string>(TEXT, Encoding::UTF_32_NATIVE,
+                                       Encoding::UTF_16_BE);
+    OffsetMap map;
+    Converter converter(Encoding::UTF_16_BE, Encoding::UTF_8);
+    converter.set_offset_map(&map);
+    std::ostringstream ss;
+    converter.convert(src.data(), src.size(), ss);
+    REQUIRE(map.destination_size() == ss.str().size());
+    check_map(map, get_boundaries(TEXT, Encoding::UTF_16_BE, Encoding::UTF_8));
+}
+
+TEST_CASE("OffsetMap from UTF-32 to UTF-16")
+{
+    using namespace Yconvert;
+    OffsetMap map;
+    Converter converter(Encoding::UTF_32_LE, Encoding::UTF_16_LE);
+    converter.set_offset_map(&map);
+    auto src = convert_to<std::string>(TEXT, Encoding::UTF_32_NATIVE,
+                                       Encoding::UTF_32_LE);
+    std::string dst;
+    converter.convert(src.data(), src.size(), dst);
+    REQUIRE(dst == convert_to<std::string>(TEXT, Encoding::UTF_32_NATIVE,
+                                           Encoding::UTF_16_LE));
+    check_map(map, get_boundaries(TEXT, Encoding::UTF_32_LE, Encoding::UTF_16_LE));
+}
+
+#ifdef YCONVERT_WIN_CODE_PAGES
+
+TEST_CASE("OffsetMap from CP1252 to UTF-16")
+{
+    using namespace Yconvert;
+    std::u32string text = U"Blåbærsyltetøy, € 12";
+    auto src = convert_to<std::string>(text, Encoding::UTF_32_NATIVE,
+                                       Encoding::WIN_CP1252);
+    OffsetMap map;
+    Converter converter(Encoding::WIN_CP1252, Encoding::UTF_16_LE);
+    converter.set_offset_map(&map);
+    std::string dst;
+    converter.convert(src.data(), src.size(), dst);
+    REQUIRE(map.runs().size() == 1);
+    check_map(map, get_boundaries(text, Encoding::WIN_CP1252, Encoding::UTF_16_LE));
+}
+
+#endif
+
+TEST_CASE("OffsetMap of ASCII text has a single run")
+{
+    using namespace Yconvert;
+    std::string src(1000, 'a');
+    OffsetMap map;
+    Converter converter(Encoding::UTF_8, Encoding::UTF_16_LE);
+    converter.set_offset_map(&map);
+    std::string dst;
+    converter.convert(src.data(), src.size(), dst);
+    REQUIRE(map.runs().size() == 1);
+    REQUIRE(map.runs()[0].count == 1000);
+    REQUIRE(map.to_destination(500) == 1000);
+    REQUIRE(map.to_source(1001) == 500);
+}
+
+TEST_CASE("OffsetMap with invalid UTF-8")
+{
+    using namespace Yconvert;
+    std::string src = "A\xC3\xA5\xFF\xFF" "B\xE2\x82";
+    OffsetMap map;
+    Converter converter(Encoding::UTF_8, Encoding::UTF_16_LE);
+    converter.set_offset_map(&map);
+
+    SECTION("REPLACE")
+    {
+        std::string dst;
+        converter.convert(src.data(), src.size(), dst);
+        REQUIRE(dst.size() == 12);
+        REQUIRE(map.source_size() == src.size());
+        REQUIRE(map.destination_size() == dst.size());
+        REQUIRE(map.to_destination(3) == 4);
+        REQUIRE(map.to_destination(4) == 6);
+        REQUIRE(map.to_destination(5) == 8);
+        REQUIRE(map.to_source(8) == 5);
+        REQUIRE(map.to_source(10) == 6);
+    }
+
+    SECTION("SKIP")
+    {
+        converter.set_error_policy(ErrorPolicy::SKIP);
+        std::string dst;
+        converter.convert(src.data(), src.size(), dst);
+        REQUIRE(dst.size() == 6);
+        REQUIRE(map.source_size() == src.size());
+        REQUIRE(map.destination_size() == dst.size());
+        REQUIRE(map.to_destination(1) == 2);
+        REQUIRE(map.to_destination(5) == 4);
+        REQUIRE(map.to_source(2) == 1);
+        // The skipped bytes are part of the code point that follows them.
+        REQUIRE(map.to_source(4) == 3);
+    }
+}
+
+TEST_CASE("OffsetMap is extended by successive conversions")
+{
+    using namespace Yconvert;
+    auto src = convert_to<std::string>(TEXT, Encoding::UTF_32_NATIVE,
+                                       Encoding::UTF_8);
+    OffsetMap map;
+    Converter converter(Encoding::UTF_8, Encoding::UTF_16_LE);
+    converter.set_offset_map(&map);
+
+    std::string dst;
+    char buffer[7];
+    size_t offset = 0;
+    while (offset != src.size())
+    {
+        auto [n, m] = converter.convert(src.data() + offset,
+                                        src.size() - offset,
+                                        buffer, sizeof(buffer));
+        REQUIRE(n != 0);
+        dst.append(buffer, m);
+        offset += n;
+    }
+
+    REQUIRE(dst == convert_to<std::string>(TEXT, Encoding::UTF_32_NATIVE,
+                                           Encoding::UTF_16_LE));
+    check_map(map, get_boundaries(TEXT, Encoding::UTF_8, Encoding::UTF_16_LE));
+}
+
+namespace
+{
+    void check_same_runs(const Yconvert::OffsetMap& a,
+                         const Yconvert::OffsetMap& b)
+    {
+        REQUIRE(a.runs().size() == b.runs().size());
+        for (size_t i = 0; i < a.runs().size(); ++i)
+        {
+            CAPTURE(i);
+            auto& r1 = a.runs()[i];
+            auto& r2 = b.runs()[i];
+            REQUIRE(r1.source_offset == r2.source_offset);
+            REQUIRE(r1.destination_offset == r2.destination_offset);
+            REQUIRE(r1.count == r2.count);
+            REQUIRE(r1.source_width == r2.source_width);
+            REQUIRE(r1.destination_width == r2.destination_width);
+        }
+    }
+
+    void check_reconvert(std::string src, size_t offset, size_t old_size,
+                         const std::string& replacement)
+    {
+        using namespace Yconvert;
+        CAPTURE(src, offset, old_size, replacement);
+        OffsetMap map;
+        Converter converter(Encoding::UTF_8, Encoding::UTF_16_LE);
+        converter.set_offset_map(&map);
+        std::string dst;
+        converter.convert(src.data(), src.size(), dst);
+
+        // The converted edit starts at or before the start of the code
+        // point that contains offset.
+        auto edit_offset = map.to_destination(offset);
+
+        src.replace(offset, old_size, replacement);
+        auto [dst_offset, dst_size] = converter.reconvert(
+            src.data(), src.size(), offset, old_size, replacement.size(), dst);
+
+        OffsetMap expected_map;
+        converter.set_offset_map(&expected_map);
+        std::string expected;
+        converter.convert(src.data(), src.size(), expected);
+        REQUIRE(dst == expected);
+        REQUIRE(dst_offset <= edit_offset);
+        REQUIRE(dst_offset + dst_size <= dst.size());
+        REQUIRE(map.source_size() == expected_map.source_size());
+        REQUIRE(map.destination_size() == expected_map.destination_size());
+        check_same_runs(map, expected_map);
+    }
+}
+
+TEST_CASE("Reconvert an edited source")
+{
+    const std::string text = "Blåbærsyltetøy, € 12 og \xF0\x9F\x98\x80!";
+
+    SECTION("Insert ASCII")
+    {
+        check_reconvert(text, 0, 0, "Søt ");
+        check_reconvert(text, 3, 0, "xyz");
+        check_reconvert(text, text.size(), 0, " Ja!");
+    }
+
+    SECTION("Delete")
+    {
+        check_reconvert(text, 0, 2, "");
+        check_reconvert(text, 2, 4, "");
+        check_reconvert(text, 0, text.size(), "");
+    }
+
+    SECTION("Replace")
+    {
+        check_reconvert(text, 2, 2, "aa");
+        check_reconvert(text, 18, 3, "$");
+        check_reconvert(text, 29, 4, "\xE2\x82\xAC");
+    }
+
+    SECTION("Edits inside code points are widened")
+    {
+        check_reconvert(text, 3, 1, "");
+        check_reconvert(text, 3, 2, "\xA6");
+        check_reconvert(text, 31, 1, "\x99");
+    }
+
+    SECTION("Edits that complete invalid neighbors")
+    {
+        check_reconvert("A\xC3", 2, 0, "\xA5");
+        check_reconvert("\x82\xAC!", 0, 0, "\xE2");
+        check_reconvert("A\xF0\x9F\x98", 4, 0, "\x80!");
+        check_reconvert("\xE2\x82x\xAC", 2, 1, "");
+    }
+
+    SECTION("Edits that break valid neighbors")
+    {
+        check_reconvert(text, 4, 0, "\xC3");
+        check_reconvert(text, 29, 0, "\x80");
+    }
+}
+
+TEST_CASE("Reconvert without an offset map")
+{
+    using namespace Yconvert;
+    Converter converter(Encoding::UTF_8, Encoding::UTF_16_LE);
+    std::string dst;
+    REQUIRE_THROWS_AS(converter.reconvert("abc", 3, 0, 0, 0, dst),
+                      YconvertException);
+}
@@ -19,3 +19,114 @@ TEST_CASE("Test UTF-16-BE decoder")
     REQUIRE(m == 14);
     REQUIRE_THAT(u, Catch::Matchers::Equals(std::vector<char32_t>{'A', 'B', 'C', 'D', 'E', 'F', 'G'}));
 }
+
+namespace
+{
+    template <bool SWAP_BYTES>
+    std::pair<size_t, size_t> count_valid_reference(const std::u16string& s)
+    {
+        auto it = reinterpret_cast<const char*>(s.data());
+        const auto begin = it;
+        const auto end = it + s.size() * 2;
+        size_t count = 0;
+        while (true)
+        {
+            auto prev = it;
+            auto value = Yconvert::Detail::next_utf16_code_point<SWAP_BYTES>(it, end);
+            if (value == Yconvert::INVALID_CHAR || value == 0)
+                return {count, size_t(prev - begin)};
+            ++count;
+        }
+    }
+
+    std::u16string swap_bytes(std::u16string s)
+    {
+        for (auto& c : s)
+            c = Yconvert::reverse_bytes(c);
+        return s;
+    }
+}
+
+TEST_CASE("Count valid UTF-16 code points in long strings")
+{
+    std::u16string text;
+    for (int i = 0; i < 10; ++i)
+        text += u"Blåbærsyltetøy \U0001F600\U0001F601 €";
+
+    Yconvert::Utf16Decoder<false> native_decoder;
+    Yconvert::Utf16Decoder<true> swapping_decoder;
+    const Yconvert::Decoder& decoder = native_decoder;
+    const Yconvert::Decoder& swapped_decoder = swapping_decoder;
+    auto check = [&](const std::u16string& s)
+    {
+        auto expected = count_valid_reference<false>(s);
+        REQUIRE(decoder.count_valid_codepoints(s.data(), s.size() * 2) == expected);
+        auto t = swap_bytes(s);
+        REQUIRE(swapped_decoder.count_valid_codepoints(t.data(), t.size() * 2) == expected);
+    };
+
+    check(text);
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        for (char16_t c : {u'\xD800', u'\xDBFF', u'\xDC00', u'\xDFFF', u'\0'})
+        {
+            auto s = text;
+            s[i] = c;
+            check(s);
+        }
+        check(text.substr(0, i));
+    }
+}
+
+TEST_CASE("Decode long UTF-16 strings")
+{
+    std::u16string text;
+    for (int i = 0; i < 10; ++i)
+        text += u"Blåbærsyltetøy, \U0001F600\U0001F601 €";
+    std::u32string expected;
+    for (int i = 0; i < 10; ++i)
+        expected += U"Blåbærsyltetøy, \U0001F600\U0001F601 €";
+
+    Yconvert::Utf16Decoder<false> decoder;
+    Yconvert::Utf16Decoder<true> swapped_decoder;
+    auto swapped_text = swap_bytes(text);
+
+    SECTION("Valid input")
+    {
+        std::u32string result(expected.size(), 0);
+        auto [m, n] = decoder.decode(text.data(), text.size() * 2,
+                                     result.data(), result.size());
+        REQUIRE(m == text.size() * 2);
+        REQUIRE(n == expected.size());
+        REQUIRE(result == expected);
+
+        std::u32string swapped_result(expected.size(), 0);
+        swapped_decoder.decode(swapped_text.data(), swapped_text.size() * 2,
+                               swapped_result.data(), swapped_result.size());
+        REQUIRE(swapped_result == expected);
+    }
+
+    SECTION("Small output buffer")
+    {
+        std::u32string result(11, 0);
+        auto [m, n] = decoder.decode(text.data(), text.size() * 2,
+                                     result.data(), result.size());
+        REQUIRE(m == 22);
+        REQUIRE(n == 11);
+        REQUIRE(result == expected.substr(0, 11));
+    }
+
+    SECTION("Invalid input")
+    {
+        text[30] = 0xDC00;
+        std::u32string result(expected.size(), 0);
+        decoder.set_error_policy(Yconvert::ErrorPolicy::REPLACE);
+        auto [m, n] = decoder.decode(text.data(), text.size() * 2,
+                                     result.data(), result.size());
+        REQUIRE(m == text.size() * 2);
+        REQUIRE(n == expected.size());
+        REQUIRE(result.substr(0, 28) == expected.substr(0, 28));
+        REQUIRE(result[28] == Yconvert::REPLACEMENT_CHARACTER);
+        REQUIRE(result.substr(29) == expected.substr(29));
+    }
+}
@@ -59,3 +59,54 @@ TEST_CASE("Test encode ASCII")
     check_encode_bytes_le(U'A', {"A\0", 2});
     check_encode_bytes_be(U'A', {"\0A", 2});
 }
+
+TEST_CASE("Test Utf16Encoder get_encoded_size")
+{
+    std::u32string str32;
+    for (int i = 0; i < 20; ++i)
+        str32 += U"AÆΩ€\U0001F600";
+    str32[41] = 0x110000;
+    str32[42] = 0xFFFFFFFF;
+    Utf16LEEncoder encoder;
+    for (size_t i = 0; i <= str32.size(); ++i)
+    {
+        std::string result;
+        encoder.encode(str32.data(), i, result);
+        REQUIRE(encoder.get_encoded_size(str32.data(), i) == result.size());
+    }
+}
+
+TEST_CASE("Test encode long UTF-32 strings")
+{
+    std::u32string str32;
+    for (int i = 0; i < 20; ++i)
+        str32 += U"Plain ASCII text, followed by ÆØÅ and €.";
+    str32[100] = U'\U0001F600';
+    str32[333] = 0x110000;
+    str32[334] = U'\U00010000';
+    str32[600] = 0xFFFFFFFF;
+
+    std::string expected;
+    auto out = back_inserter(expected);
+    for (auto c : str32)
+        Detail::add_utf16_bytes<IS_BIG_ENDIAN>(c, out);
+
+    Utf16LEEncoder encoder;
+    SECTION("Encode to string")
+    {
+        std::string result;
+        encoder.encode(str32.data(), str32.size(), result);
+        REQUIRE(result == expected);
+    }
+
+    SECTION("Encode to a buffer that is too small")
+    {
+        std::string result(expected.size() - 3, '\0');
+        auto [n, m] = encoder.encode(str32.data(), str32.size(),
+                                     result.data(), result.size());
+        REQUIRE(n == str32.size() - 2);
+        REQUIRE(m == expected.size() - 4);
+        result.resize(m);
+        REQUIRE(result == expected.substr(0, m));
+    }
+}
@@ -20,3 +20,32 @@ TEST_CASE("Test UTF-32 decoder")
     REQUIRE(u[0] == 'A');
     REQUIRE(u[1] == 'B');
 }
+
+TEST_CASE("Test UTF-32 count_valid_codepoints")
+{
+    std::u32string str(100, U'A');
+    str[50] = U'\U0010FFFF';
+    const Yconvert::Decoder& decoder = Yconvert::Utf32LEDecoder();
+    const Yconvert::Decoder& be_decoder = Yconvert::Utf32BEDecoder();
+    auto size = str.size() * 4;
+    REQUIRE(decoder.count_valid_codepoints(str.data(), size)
+            == std::pair<size_t, size_t>(100, size));
+    REQUIRE(decoder.count_valid_codepoints(str.data(), size - 1)
+            == std::pair<size_t, size_t>(99, size - 4));
+
+    for (char32_t invalid : {char32_t(0), char32_t(0xD800), char32_t(0xDFFF),
+                             char32_t(0x110000), char32_t(0x80000000)})
+    {
+        for (size_t i : {0, 9, 40, 99})
+        {
+            auto s = str;
+            s[i] = invalid;
+            REQUIRE(decoder.count_valid_codepoints(s.data(), size)
+                    == std::pair<size_t, size_t>(i, i * 4));
+            for (auto& c : s)
+                c = Yconvert::reverse_bytes(c);
+            REQUIRE(be_decoder.count_valid_codepoints(s.data(), size)
+                    == std::pair<size_t, size_t>(i, i * 4));
+        }
+    }
+}
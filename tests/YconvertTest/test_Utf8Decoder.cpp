@@ -34,3 +34,20 @@ TEST_CASE("Test Utf8Decoder")
         REQUIRE_THROWS(decoder.decode(s.data(), s.size(), u.data(), u.size()));
     }
 }
+
+TEST_CASE("Utf8Decoder skips from the invalid byte")
+{
+    // The first code point is two bytes long, the invalid one is a
+    // single byte.
+    std::string s(U8("Æ" "\xFF" "AB"));
+    Yconvert::Utf8Decoder decoder;
+    std::vector<char32_t> u(4);
+    for (auto policy : {Yconvert::ErrorPolicy::SKIP,
+                        Yconvert::ErrorPolicy::IGNORE})
+    {
+        decoder.set_error_policy(policy);
+        REQUIRE(decoder.decode(s.data(), s.size(), u.data(), u.size())
+                == std::pair<size_t, size_t>(5, 3));
+        REQUIRE(u == std::vector<char32_t>{U'Æ', 'A', 'B', 0});
+    }
+}
@@ -31,3 +31,19 @@ TEST_CASE("Test Utf8Encoder to char array")
     REQUIRE(result[2] == '\x86');
     REQUIRE(encoder.encode(str32.data(), str32.size(), result, 7) == s(5, 7));
 }
+
+TEST_CASE("Test Utf8Encoder get_encoded_size")
+{
+    std::u32string str32;
+    for (int i = 0; i < 20; ++i)
+        str32 += U"AÆΩ€\U0001F600";
+    str32[41] = 0x110000;
+    str32[42] = 0xFFFFFFFF;
+    Yconvert::Utf8Encoder encoder;
+    for (size_t i = 0; i <= str32.size(); ++i)
+    {
+        std::string result;
+        encoder.encode(str32.data(), i, result);
+        REQUIRE(encoder.get_encoded_size(str32.data(), i) == result.size());
+    }
+}
@@ -9,3 +9,6 @@ fi
 
 echo Making CodePageDefinitions.hpp
 python3 "$SCRIPT_DIR/make_codepage_file.py" $1 >CodePageDefinitions.hpp
+
+echo Making CodePageModels.hpp
+python3 "$SCRIPT_DIR/make_model_file.py" $1 >CodePageModels.hpp
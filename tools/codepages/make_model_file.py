@@ -0,0 +1,307 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+# ===========================================================================
+# Copyright © 2026 Jan Erik Breimo. All rights reserved.
+# Created by Jan Erik Breimo on 2026-10-18.
+#
+# This file is distributed under the Zero-Clause BSD License.
+# License text is included with the source distribution.
+# ===========================================================================
+"""
+Generates CodePageModels.hpp, the byte-bigram models that are used to tell
+single-byte code pages apart.
+
+Each byte in each code page is assigned a character class based on the
+Unicode properties of the character it represents: its script, whether
+it is a letter, digit, punctuation etc., its case and, for Latin letters,
+how common it is in European languages. The score of a pair of bytes in
+a given code page is then looked up in a small matrix of class-bigram
+scores, which is shared by all code pages.
+"""
+import codegen
+import datetime
+import os
+import sys
+import unicodedata
+
+
+# The order determines the class numbers in the generated file.
+CLASSES = [
+    "CONTROL",
+    "UNDEFINED",
+    "SPACE",
+    "DIGIT",
+    "PUNCTUATION",
+    "SYMBOL",
+    "ASCII_UPPER",
+    "ASCII_LOWER",
+    "LATIN_UPPER",
+    "LATIN_LOWER",
+    "LATIN_EXT_UPPER",
+    "LATIN_EXT_LOWER",
+    "LATIN_RARE",
+    "CYRILLIC_UPPER",
+    "CYRILLIC_LOWER",
+    "CYRILLIC_RARE",
+    "GREEK_UPPER",
+    "GREEK_LOWER",
+    "HEBREW",
+    "ARABIC",
+    "THAI",
+    "OTHER_LETTER",
+]
+
+CLASS_INDEX = {name: i for i, name in enumerate(CLASSES)}
+
+# Letters that are common in Western European languages.
+LATIN_COMMON = "àáâãäåæçèéêëìíîïñòóôõöøùúûüýÿßœ"
+
+# Letters that are common in other European languages.
+LATIN_EXTENDED = ("ăąćčďđėęěğıįľĺłńňőŕřśşšţťůűųźżžșțāēīūķļņģðþ"
+                  "ẁẃŵŷ")
+
+# Letters used in Russian, Ukrainian, Belarusian, Bulgarian and Serbian.
+CYRILLIC_COMMON = "абвгдеёжзийклмнопрстуфхцчшщъыьэюяєіїґўђјљњћџ"
+
+# Properties of the classes that the score matrix is computed from.
+# script, case, rarity (0 = common, 1 = less common, 2 = rare)
+LETTER_CLASSES = {
+    "ASCII_UPPER": ("LATIN", "UPPER", 0),
+    "ASCII_LOWER": ("LATIN", "LOWER", 0),
+    "LATIN_UPPER": ("LATIN", "UPPER", 0),
+    "LATIN_LOWER": ("LATIN", "LOWER", 0),
+    "LATIN_EXT_UPPER": ("LATIN", "UPPER", 1),
+    "LATIN_EXT_LOWER": ("LATIN", "LOWER", 1),
+    "LATIN_RARE": ("LATIN", None, 2),
+    "CYRILLIC_UPPER": ("CYRILLIC", "UPPER", 0),
+    "CYRILLIC_LOWER": ("CYRILLIC", "LOWER", 0),
+    "CYRILLIC_RARE": ("CYRILLIC", None, 2),
+    "GREEK_UPPER": ("GREEK", "UPPER", 0),
+    "GREEK_LOWER": ("GREEK", "LOWER", 0),
+    "HEBREW": ("HEBREW", None, 0),
+    "ARABIC": ("ARABIC", None, 0),
+    "THAI": ("THAI", None, 0),
+    "OTHER_LETTER": ("OTHER", None, 2),
+}
+
+SEPARATORS = {"SPACE", "PUNCTUATION"}
+
+
+def classify_letter(ch):
+    name = unicodedata.name(ch, "")
+    script = name.split(" ")[0]
+    lower = ch.lower()
+    is_upper = unicodedata.category(ch) == "Lu"
+    if script == "LATIN":
+        if lower in LATIN_COMMON:
+            return "LATIN_UPPER" if is_upper else "LATIN_LOWER"
+        if lower in LATIN_EXTENDED:
+            return "LATIN_EXT_UPPER" if is_upper else "LATIN_EXT_LOWER"
+        return "LATIN_RARE"
+    if script == "CYRILLIC":
+        if lower in CYRILLIC_COMMON:
+            return "CYRILLIC_UPPER" if is_upper else "CYRILLIC_LOWER"
+        return "CYRILLIC_RARE"
+    if script == "GREEK":
+        return "GREEK_UPPER" if is_upper else "GREEK_LOWER"
+    if script in ("HEBREW", "ARABIC", "THAI"):
+        return script
+    return "OTHER_LETTER"
+
+
+def classify(code_point):
+    if code_point is None:
+        return "UNDEFINED"
+    ch = chr(code_point)
+    if code_point < 0x80:
+        if ch in " \t\n\r\f":
+            return "SPACE"
+        if "A" <= ch <= "Z":
+            return "ASCII_UPPER"
+        if "a" <= ch <= "z":
+            return "ASCII_LOWER"
+    category = unicodedata.category(ch)
+    if category == "Cc":
+        return "CONTROL"
+    if category == "Zs":
+        return "SPACE"
+    if category == "Nd":
+        return "DIGIT"
+    if category[0] == "P":
+        return "PUNCTUATION"
+    if category[0] in "SNZ" or category == "Cf":
+        return "SYMBOL"
+    # Letters and combining marks.
+    return classify_letter(ch)
+
+
+def get_score(a, b):
+    """
+    Returns the score of the character class a followed by b. Positive
+    scores are for pairs that are common in text, negative for pairs that
+    are unlikely.
+    """
+    if "UNDEFINED" in (a, b):
+        return -10
+    if "CONTROL" in (a, b):
+        return -8
+    la = LETTER_CLASSES.get(a)
+    lb = LETTER_CLASSES.get(b)
+    if la and lb:
+        if la[0] != lb[0]:
+            return -6
+        score = 3 - 2 * max(la[2], lb[2])
+        if la[1] == "LOWER" and lb[1] == "UPPER":
+            score -= 4
+        return score
+    if la or lb:
+        letter = la or lb
+        other = b if la else a
+        if other in SEPARATORS:
+            return 1 - 2 * letter[2]
+        if other == "DIGIT":
+            return -1
+        return -3
+    if a == "SYMBOL" or b == "SYMBOL":
+        return -1
+    return 0
+
+
+def read_character_map(file_name):
+    mapping = [None] * 256
+    for line in open(file_name):
+        line = line.lstrip()
+        if not line or line[0] == "#":
+            continue
+        parts = line.split("\t", maxsplit=2)
+        if len(parts) < 2 or not parts[1] or parts[1].isspace():
+            continue
+        mapping[int(parts[0], 0)] = int(parts[1], 0)
+    return mapping
+
+
+def read_config_file(file_name):
+    root = os.path.dirname(os.path.abspath(file_name))
+    config = []
+    for line in open(file_name):
+        line = line.strip()
+        if not line:
+            continue
+        label, path = line.split(";")
+        config.append((label, os.path.join(root, path)))
+    return config
+
+
+FILE_TEMPLATE = """\
+//****************************************************************************
+// Copyright © [[[year]]] Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on [[[date]]]
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+// Generated by tools/codepages/make_model_file.py, do not edit.
+
+#include <cstddef>
+#include <cstdint>
+#include "Yconvert/Encoding.hpp"
+
+namespace Yconvert::Detail
+{
+    /**
+     * @brief The character classes that the bytes in each code page
+     *  are mapped to.
+     */
+    enum class CharClass : uint8_t
+    {
+        [[[classes]]]
+    };
+
+    constexpr size_t CHAR_CLASS_COUNT = [[[class_count]]];
+
+    /**
+     * @brief The score of each pair of character classes. Positive
+     *  scores are for pairs that are common in text, negative scores for
+     *  pairs that are unlikely.
+     */
+    constexpr int8_t CHAR_CLASS_SCORES[CHAR_CLASS_COUNT][CHAR_CLASS_COUNT] = {
+        [[[scores]]]
+    };
+    [[[tables]]]
+
+    /**
+     * @brief A code page and the character classes of its 256 bytes.
+     */
+    struct CodePageModel
+    {
+        Encoding encoding;
+        const uint8_t* classes;
+    };
+
+    /**
+     * @brief The models of the code pages that are compiled in, ordered
+     *  by how common the code pages are. The last model is a sentinel
+     *  with Encoding::UNKNOWN.
+     */
+    constexpr CodePageModel CODE_PAGE_MODELS[] = {
+        [[[models]]]
+        {Encoding::UNKNOWN, nullptr}
+    };
+}
+"""
+
+# The order of the code page families in CODE_PAGE_MODELS.
+FAMILY_ORDER = ["WIN", "ISO", "DOS", "MAC"]
+
+
+def main(args):
+    if len(args) != 1:
+        print("usage: %s <configuration file>" % sys.argv[0])
+        return 1
+    families = {}
+    for label, path in read_config_file(args[0]):
+        print(f"{label} {path}", file=sys.stderr)
+        name = os.path.splitext(os.path.basename(path))[0].replace("-", "_")
+        name = f"{label}_{name}"
+        mapping = read_character_map(path)
+        classes = [CLASS_INDEX[classify(c)] for c in mapping]
+        families.setdefault(label, []).append((name, classes))
+
+    classes = [f"{c} = {i}," for i, c in enumerate(CLASSES)]
+
+    scores = []
+    for a in CLASSES:
+        values = ", ".join(f"{get_score(a, b):3d}" for b in CLASSES)
+        scores.append(f"{{{values}}}, // {a}")
+
+    tables = []
+    models = []
+    for label in sorted(families, key=FAMILY_ORDER.index):
+        tables.append("")
+        tables.append(f"#ifdef YCONVERT_{label}_CODE_PAGES")
+        models.append(f"#ifdef YCONVERT_{label}_CODE_PAGES")
+        for name, values in families[label]:
+            tables.append("")
+            tables.append(f"constexpr uint8_t {name}_CLASSES[256] = {{")
+            for i in range(0, 256, 16):
+                line = ", ".join(f"{v:2d}" for v in values[i:i + 16])
+                tables.append(f"    {line}," if i + 16 < 256 else f"    {line}")
+            tables.append("};")
+            models.append(f"{{Encoding::{name}, {name}_CLASSES}},")
+        tables.append("")
+        tables.append("#endif")
+        models.append("#endif")
+
+    date = datetime.date.today()
+    expander = codegen.DictExpander(dict(
+        classes=classes, class_count=len(CLASSES), scores=scores,
+        tables=tables, models=models, year=date.year,
+        date="%d-%02d-%02d" % (date.year, date.month, date.day)))
+    text = codegen.make_text(FILE_TEMPLATE, expander)
+    print("\n".join(s.rstrip() for s in text.split("\n")))
+    return 0
+
+
+sys.exit(main(sys.argv[1:]))